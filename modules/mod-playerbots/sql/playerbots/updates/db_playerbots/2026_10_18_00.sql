@@ -0,0 +1,6 @@
+-- random bot events are upserted in batches, keep only the newest row of each bot event
+DELETE `older` FROM `playerbots_random_bots` `older`
+JOIN `playerbots_random_bots` `newer` ON `older`.`owner` = `newer`.`owner` AND `older`.`bot` = `newer`.`bot`
+    AND `older`.`event` = `newer`.`event` AND `older`.`id` < `newer`.`id`;
+
+ALTER TABLE `playerbots_random_bots` ADD UNIQUE KEY `owner_bot_event` (`owner`, `bot`, `event`);
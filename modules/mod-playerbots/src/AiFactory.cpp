@@ -5,6 +5,13 @@
 
 #include "AiFactory.h"
 
+#include <chrono>
+#include <fstream>
+
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
 #include "BattlegroundMgr.h"
 #include "DKAiObjectContext.h"
 #include "DruidAiObjectContext.h"
@@ -55,6 +62,58 @@ AiObjectContext* AiFactory::createAiObjectContext(Player* player, PlayerbotAI* b
     return new AiObjectContext(botAI);
 }
 
+// resident memory of the whole process, 0 where it cannot be read
+static uint64 GetResidentBytes()
+{
+#ifdef __linux__
+    std::ifstream statm("/proc/self/statm");
+    uint64 size = 0;
+    uint64 resident = 0;
+    if (statm >> size >> resident)
+        return resident * sysconf(_SC_PAGESIZE);
+#endif
+
+    return 0;
+}
+
+void AiFactory::BenchmarkContexts(Player* player, uint32 count)
+{
+    PlayerbotAI* botAI = GET_PLAYERBOT_AI(player);
+    if (!botAI || !count)
+        return;
+
+    std::vector<AiObjectContext*> contexts;
+    contexts.reserve(count);
+
+    // other threads allocate too, the delta is only meaningful on an idle server
+    uint64 residentBefore = GetResidentBytes();
+    auto started = std::chrono::steady_clock::now();
+    for (uint32 i = 0; i < count; ++i)
+        contexts.push_back(createAiObjectContext(player, botAI));
+
+    uint64 elapsed =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - started).count();
+    uint64 residentAfter = GetResidentBytes();
+
+    size_t creators = contexts.front()->GetCreatorCount();
+
+    for (AiObjectContext* context : contexts)
+        delete context;
+
+    LOG_INFO("playerbots", "Context benchmark: {} contexts in {} ms, {} us per context, {} creator entries", count,
+             elapsed / 1000, elapsed / count, creators);
+
+    if (!residentBefore || !residentAfter)
+    {
+        LOG_INFO("playerbots", "Context benchmark: resident memory cannot be read on this platform");
+        return;
+    }
+
+    int64 residentDelta = int64(residentAfter) - int64(residentBefore);
+    LOG_INFO("playerbots", "Context benchmark: resident memory {} KB -> {} KB, {} KB for all, {} bytes per context",
+             residentBefore / 1024, residentAfter / 1024, residentDelta / 1024, residentDelta / int64(count));
+}
+
 uint8 AiFactory::GetPlayerSpecTab(Player* bot)
 {
     std::map<uint8, uint32> tabs = GetPlayerSpecTabs(bot);
@@ -32,6 +32,9 @@ public:
     static std::map<uint8, uint32> GetPlayerSpecTabs(Player* player);
     static BotRoles GetPlayerRoles(Player* player);
     static std::string GetPlayerSpecName(Player* player);
+
+    // times building the object contexts of many bots of the class of the given bot and measures their memory
+    static void BenchmarkContexts(Player* player, uint32 count);
 };
 
 #endif
@@ -107,7 +107,8 @@ void FleeManager::calculatePossibleDestinations(std::vector<FleePoint*>& points)
                 if (map && map->IsInWater(bot->GetPhaseMask(), x, y, z, bot->GetCollisionHeight()))
                     continue;
 
-                if (!bot->IsWithinLOS(x, y, z) || (target && !target->IsWithinLOS(x, y, z)))
+                if (!sServerFacade->IsWithinLOS(bot, x, y, z) ||
+                    (target && !sServerFacade->IsWithinLOS(target, x, y, z)))
                     continue;
 
                 FleePoint* point = new FleePoint(botAI, x, y, z);
@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, released under GNU GPL v2 license, you may redistribute it
+ * and/or modify it under version 2 of the License, or (at your option), any later version.
+ */
+
+#include "LineOfSightCache.h"
+
+#include "GameTime.h"
+#include "Map.h"
+#include "PerformanceMonitor.h"
+#include "Playerbots.h"
+
+// ends of a sight line closer than this share a result
+#define LOS_CACHE_PRECISION 0.25f
+// a full map cache is emptied instead of evicting single lines
+#define LOS_CACHE_MAX_LINES 32768
+// caches of maps nobody looked at for this long are dropped
+#define LOS_CACHE_EXPIRE_TIME 60000
+
+static int32 SnapToGrid(float coord) { return int32(std::lround(coord / LOS_CACHE_PRECISION)); }
+
+std::size_t LineOfSightKeyHash::operator()(LineOfSightKey const& key) const
+{
+    std::size_t hash = key.phaseMask;
+    for (int32 coord : {key.x1, key.y1, key.z1, key.x2, key.y2, key.z2})
+        hash = hash * 31 + std::hash<int32>()(coord);
+
+    return hash;
+}
+
+LineOfSightCache::LineOfSightCache() : counter(sPerformanceMonitor->GetCounter("LineOfSightCache")) {}
+
+bool LineOfSightCache::IsInLineOfSight(Map* map, float x1, float y1, float z1, float x2, float y2, float z2,
+                                       uint32 phaseMask)
+{
+    if (!sPlayerbotAIConfig->losCacheTime)
+        return map->isInLineOfSight(x1, y1, z1, x2, y2, z2, phaseMask, LINEOFSIGHT_ALL_CHECKS,
+                                    VMAP::ModelIgnoreFlags::Nothing);
+
+    uint64 now = GameTime::GetGameTimeMS().count();
+    std::shared_ptr<MapLineOfSightCache> cache = GetMapCache(map, now);
+    LineOfSightKey key{SnapToGrid(x1), SnapToGrid(y1), SnapToGrid(z1),
+                       SnapToGrid(x2), SnapToGrid(y2), SnapToGrid(z2), phaseMask};
+    // a door or moving gameobject near the line may have blocked or freed it
+    uint32 treeVersion = map->GetDynamicMapTree().getVersion(x1, y1, x2, y2);
+
+    {
+        std::lock_guard<std::mutex> guard(cache->lock);
+        cache->lastUsed = now;
+
+        auto itr = cache->results.find(key);
+        if (itr != cache->results.end() && itr->second.treeVersion == treeVersion &&
+            itr->second.time + sPlayerbotAIConfig->losCacheTime >= now)
+        {
+            if (sPlayerbotAIConfig->perfMonEnabled)
+                ++counter->hits;
+
+            return itr->second.inLineOfSight;
+        }
+    }
+
+    if (sPlayerbotAIConfig->perfMonEnabled)
+        ++counter->misses;
+
+    bool inLineOfSight = map->isInLineOfSight(x1, y1, z1, x2, y2, z2, phaseMask, LINEOFSIGHT_ALL_CHECKS,
+                                              VMAP::ModelIgnoreFlags::Nothing);
+
+    {
+        std::lock_guard<std::mutex> guard(cache->lock);
+        if (cache->results.size() >= LOS_CACHE_MAX_LINES)
+            cache->results.clear();
+
+        cache->results[key] = LineOfSightResult{inLineOfSight, treeVersion, now};
+    }
+
+    return inLineOfSight;
+}
+
+std::shared_ptr<MapLineOfSightCache> LineOfSightCache::GetMapCache(Map* map, uint64 now)
+{
+    uint64 key = (uint64(map->GetId()) << 32) | map->GetInstanceId();
+
+    {
+        std::shared_lock<std::shared_mutex> guard(mapsLock);
+        auto itr = maps.find(key);
+        if (itr != maps.end())
+            return itr->second;
+    }
+
+    std::unique_lock<std::shared_mutex> guard(mapsLock);
+
+    for (auto itr = maps.begin(); itr != maps.end();)
+    {
+        if (itr->first != key && itr->second->lastUsed + LOS_CACHE_EXPIRE_TIME < now)
+            itr = maps.erase(itr);
+        else
+            ++itr;
+    }
+
+    std::shared_ptr<MapLineOfSightCache>& cache = maps[key];
+    if (!cache)
+    {
+        cache = std::make_shared<MapLineOfSightCache>();
+        cache->lastUsed = now;
+    }
+
+    return cache;
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, released under GNU GPL v2 license, you may redistribute it
+ * and/or modify it under version 2 of the License, or (at your option), any later version.
+ */
+
+#ifndef _PLAYERBOT_LINEOFSIGHTCACHE_H
+#define _PLAYERBOT_LINEOFSIGHTCACHE_H
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include "Common.h"
+
+class Map;
+struct PerformanceCounter;
+
+// Both ends of a sight line snapped to a small grid, with the phase it was checked in
+struct LineOfSightKey
+{
+    int32 x1, y1, z1;
+    int32 x2, y2, z2;
+    uint32 phaseMask;
+
+    bool operator==(LineOfSightKey const& other) const
+    {
+        return x1 == other.x1 && y1 == other.y1 && z1 == other.z1 && x2 == other.x2 && y2 == other.y2 &&
+               z2 == other.z2 && phaseMask == other.phaseMask;
+    }
+};
+
+struct LineOfSightKeyHash
+{
+    std::size_t operator()(LineOfSightKey const& key) const;
+};
+
+struct LineOfSightResult
+{
+    bool inLineOfSight;
+    // version of the gameobject models around the line when it was checked
+    uint32 treeVersion;
+    uint64 time;
+};
+
+struct MapLineOfSightCache
+{
+    std::mutex lock;
+    std::atomic<uint64> lastUsed = 0;
+    std::unordered_map<LineOfSightKey, LineOfSightResult, LineOfSightKeyHash> results;
+};
+
+// Line of sight results of all bots of a map, bots of one group mostly look along the same lines.
+class LineOfSightCache
+{
+public:
+    LineOfSightCache();
+    virtual ~LineOfSightCache() {}
+    static LineOfSightCache* instance()
+    {
+        static LineOfSightCache instance;
+        return &instance;
+    }
+
+    bool IsInLineOfSight(Map* map, float x1, float y1, float z1, float x2, float y2, float z2, uint32 phaseMask);
+
+private:
+    std::shared_ptr<MapLineOfSightCache> GetMapCache(Map* map, uint64 now);
+
+    std::shared_mutex mapsLock;
+    // shared with the checks still using a table when another map thread drops it
+    std::unordered_map<uint64, std::shared_ptr<MapLineOfSightCache>> maps;
+    PerformanceCounter* counter;
+};
+
+#define sLineOfSightCache LineOfSightCache::instance()
+
+#endif
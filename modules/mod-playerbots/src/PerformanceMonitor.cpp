@@ -5,51 +5,326 @@
 
 #include "PerformanceMonitor.h"
 
+#include <bit>
+
+#include "AiObject.h"
+#include "Metric.h"
 #include "Playerbots.h"
 
-PerformanceMonitorOperation* PerformanceMonitor::start(PerformanceMetric metric, std::string const name,
-                                                       PerformanceStack* stack)
+// ids are only added, so a thread keeps what it looked up once and asks the monitor for new names only
+static thread_local std::unordered_map<std::string, uint32> threadLeafIds[MAX_PERF_MON_METRIC];
+static thread_local std::unordered_map<uint64, uint32> threadPathIds;
+static thread_local PerformanceShard* threadShard = nullptr;
+
+static char const* GetMetricName(PerformanceMetric metric)
+{
+    switch (metric)
+    {
+        case PERF_MON_TRIGGER:
+            return "Trigger";
+        case PERF_MON_VALUE:
+            return "Value";
+        case PERF_MON_ACTION:
+            return "Action";
+        case PERF_MON_RNDBOT:
+            return "RndBot";
+        case PERF_MON_TOTAL:
+            return "Total";
+        default:
+            return "?";
+    }
+}
+
+void PerformanceTotals::Add(PerformanceData const& data)
+{
+    totalTime += data.totalTime.load(std::memory_order_relaxed);
+    maxTime = std::max<uint64>(maxTime, data.maxTime.load(std::memory_order_relaxed));
+    count += data.count.load(std::memory_order_relaxed);
+    for (uint32 i = 0; i < PERF_MON_BUCKETS; ++i)
+        buckets[i] += data.buckets[i].load(std::memory_order_relaxed);
+}
+
+void PerformanceTotals::Add(PerformanceTotals const& totals)
+{
+    totalTime += totals.totalTime;
+    maxTime = std::max(maxTime, totals.maxTime);
+    count += totals.count;
+    for (uint32 i = 0; i < PERF_MON_BUCKETS; ++i)
+        buckets[i] += totals.buckets[i];
+}
+
+uint64 PerformanceTotals::Percentile(uint32 percentile) const
 {
-    if (!sPlayerbotAIConfig->perfMonEnabled)
+    uint64 wanted = (count * percentile + 99) / 100;
+    uint64 seen = 0;
+    for (uint32 i = 0; i < PERF_MON_BUCKETS; ++i)
+    {
+        seen += buckets[i];
+        if (seen && seen >= wanted)
+            return std::min<uint64>((uint64(1) << i) - 1, maxTime);
+    }
+
+    return maxTime;
+}
+
+PerformanceShard::PerformanceShard()
+{
+    for (std::atomic<PerformanceData*>& chunk : chunks)
+        chunk = nullptr;
+}
+
+PerformanceShard::~PerformanceShard()
+{
+    for (std::atomic<PerformanceData*>& chunk : chunks)
+        delete[] chunk.load();
+}
+
+PerformanceData* PerformanceShard::Get(uint32 id)
+{
+    uint32 index = id / PERF_MON_CHUNK_SIZE;
+    if (index >= PERF_MON_MAX_CHUNKS)
         return nullptr;
 
-    std::string stackName = name;
+    PerformanceData* chunk = chunks[index].load(std::memory_order_relaxed);
+    if (!chunk)
+    {
+        chunk = new PerformanceData[PERF_MON_CHUNK_SIZE]();
+        chunks[index].store(chunk, std::memory_order_release);
+    }
+
+    return &chunk[id % PERF_MON_CHUNK_SIZE];
+}
+
+PerformanceData const* PerformanceShard::Find(uint32 id) const
+{
+    uint32 index = id / PERF_MON_CHUNK_SIZE;
+    if (index >= PERF_MON_MAX_CHUNKS)
+        return nullptr;
+
+    PerformanceData const* chunk = chunks[index].load(std::memory_order_acquire);
+    return chunk ? &chunk[id % PERF_MON_CHUNK_SIZE] : nullptr;
+}
+
+PerformanceMonitorScope::PerformanceMonitorScope(PerformanceMetric metric, std::string const& name,
+                                                 PerformanceStack* stack)
+    : id(0), stack(nullptr)
+{
+    if (sPerformanceMonitor->IsEnabled())
+        Start(sPerformanceMonitor->GetId(metric, name), stack);
+}
+
+PerformanceMonitorScope::PerformanceMonitorScope(PerformanceMetric metric, AiNamedObject* object,
+                                                 PerformanceStack* stack)
+    : id(0), stack(nullptr)
+{
+    if (!sPerformanceMonitor->IsEnabled())
+        return;
+
+    // ids are never removed, the name of an object is built and hashed only once
+    uint32 leafId = object->performanceId.load(std::memory_order_relaxed);
+    if (!leafId)
+    {
+        leafId = sPerformanceMonitor->GetId(metric, object->getName());
+        object->performanceId.store(leafId, std::memory_order_relaxed);
+    }
+
+    Start(leafId, stack);
+}
+
+PerformanceMonitorScope::PerformanceMonitorScope(uint32 id) : id(0), stack(nullptr)
+{
+    if (id && sPerformanceMonitor->IsEnabled())
+        Start(id, nullptr);
+}
+
+void PerformanceMonitorScope::Start(uint32 leafId, PerformanceStack* stack)
+{
+    id = stack && !stack->empty() ? sPerformanceMonitor->GetId(stack->back(), leafId) : leafId;
+    if (!id)
+        return;
+
+    this->stack = stack;
+    if (stack)
+        stack->push_back(id);
+
+    started = std::chrono::steady_clock::now();
+}
+
+void PerformanceMonitorScope::finish()
+{
+    if (!id)
+        return;
+
+    uint64 elapsed =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - started).count();
+    sPerformanceMonitor->AddSample(id, elapsed);
 
     if (stack)
     {
-        if (!stack->empty())
-        {
-            std::ostringstream out;
-            out << stackName << " [";
+        if (!stack->empty() && stack->back() == id)
+            stack->pop_back();
+        else
+            stack->erase(std::remove(stack->begin(), stack->end(), id), stack->end());
+    }
 
-            for (std::vector<std::string>::reverse_iterator i = stack->rbegin(); i != stack->rend(); ++i)
-                out << *i << (std::next(i) == stack->rend() ? "" : "|");
+    id = 0;
+}
 
-            out << "]";
+void PerformanceMonitorOperation::finish()
+{
+    scope.finish();
+    delete this;
+}
 
-            stackName = out.str().c_str();
-        }
+PerformanceMonitor::PerformanceMonitor() { entries.push_back({PERF_MON_TOTAL, "", 0}); }
+
+PerformanceMonitorOperation* PerformanceMonitor::start(PerformanceMetric metric, std::string const name,
+                                                       PerformanceStack* stack)
+{
+    if (!IsEnabled())
+        return nullptr;
+
+    return new PerformanceMonitorOperation(metric, name, stack);
+}
+
+bool PerformanceMonitor::IsEnabled() const { return sPlayerbotAIConfig->perfMonEnabled; }
 
-        stack->push_back(name);
+uint32 PerformanceMonitor::GetId(PerformanceMetric metric, std::string const& name)
+{
+    std::unordered_map<std::string, uint32>& threadIds = threadLeafIds[metric];
+    auto itr = threadIds.find(name);
+    if (itr != threadIds.end())
+        return itr->second;
+
+    std::lock_guard<std::mutex> guard(lock);
+    uint32& id = leafIds[std::make_pair(metric, name)];
+    if (!id)
+        id = AddEntry(metric, name, 0);
+
+    threadIds[name] = id;
+    return id;
+}
+
+uint32 PerformanceMonitor::GetId(uint32 parent, uint32 leafId)
+{
+    uint64 key = (uint64(parent) << 32) | leafId;
+    auto itr = threadPathIds.find(key);
+    if (itr != threadPathIds.end())
+        return itr->second;
+
+    std::lock_guard<std::mutex> guard(lock);
+    uint32& id = pathIds[std::make_pair(parent, leafId)];
+    if (!id)
+        id = AddEntry(entries[leafId].metric, entries[leafId].name, parent);
+
+    threadPathIds[key] = id;
+    return id;
+}
+
+uint32 PerformanceMonitor::AddEntry(PerformanceMetric metric, std::string const& name, uint32 parent)
+{
+    // scopes past the last chunk are not measured
+    if (entries.size() >= PERF_MON_CHUNK_SIZE * PERF_MON_MAX_CHUNKS)
+        return 0;
+
+    entries.push_back({metric, name, parent});
+    return entries.size() - 1;
+}
+
+PerformanceShard* PerformanceMonitor::GetShard()
+{
+    if (!threadShard)
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        shards.push_back(std::make_unique<PerformanceShard>());
+        threadShard = shards.back().get();
     }
 
+    return threadShard;
+}
+
+void PerformanceMonitor::AddSample(uint32 id, uint64 elapsed)
+{
+    PerformanceData* data = GetShard()->Get(id);
+    if (!data)
+        return;
+
+    // only this thread writes the shard, the atomics just keep printing from reading torn values
+    uint32 bucket = std::min<uint32>(std::bit_width(elapsed), PERF_MON_BUCKETS - 1);
+    data->totalTime.store(data->totalTime.load(std::memory_order_relaxed) + elapsed, std::memory_order_relaxed);
+    if (data->maxTime.load(std::memory_order_relaxed) < elapsed)
+        data->maxTime.store(elapsed, std::memory_order_relaxed);
+    data->count.store(data->count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    data->buckets[bucket].store(data->buckets[bucket].load(std::memory_order_relaxed) + 1,
+                                std::memory_order_relaxed);
+}
+
+PerformanceCounter* PerformanceMonitor::GetCounter(std::string const name)
+{
     std::lock_guard<std::mutex> guard(lock);
-    PerformanceData* pd = data[metric][stackName];
-    if (!pd)
+    PerformanceCounter*& counter = counters[name];
+    if (!counter)
+        counter = new PerformanceCounter();
+
+    return counter;
+}
+
+static std::string const GetEntryName(std::vector<PerformanceEntry> const& entries, uint32 id, bool fullStack)
+{
+    PerformanceEntry const& entry = entries[id];
+    if (!entry.parent)
+        return entry.name;
+
+    // "name [parent|parent of parent|...]" with the innermost parent first
+    std::ostringstream out;
+    out << entry.name << " [";
+    for (uint32 parent = entry.parent; parent; parent = entries[parent].parent)
     {
-        pd = new PerformanceData();
-        pd->minTime = 0;
-        pd->maxTime = 0;
-        pd->totalTime = 0;
-        pd->count = 0;
-        data[metric][stackName] = pd;
+        out << entries[parent].name;
+        if (!fullStack || !entries[parent].parent)
+            break;
+
+        out << "|";
     }
 
-    return new PerformanceMonitorOperation(pd, name, stack);
+    out << "]";
+    return out.str();
+}
+
+std::map<PerformanceMetric, std::map<std::string, PerformanceTotals>> PerformanceMonitor::Collect(bool fullStack)
+{
+    std::vector<PerformanceEntry> entries;
+    std::vector<PerformanceShard const*> shards;
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        entries = this->entries;
+        for (std::unique_ptr<PerformanceShard> const& shard : this->shards)
+            shards.push_back(shard.get());
+    }
+
+    std::map<PerformanceMetric, std::map<std::string, PerformanceTotals>> totals;
+    for (uint32 id = 1; id < entries.size(); ++id)
+    {
+        PerformanceTotals idTotals;
+        for (PerformanceShard const* shard : shards)
+        {
+            if (PerformanceData const* data = shard->Find(id))
+                idTotals.Add(*data);
+        }
+
+        if (!idTotals.count)
+            continue;
+
+        // stacks cut after the first parent may fall together
+        totals[entries[id].metric][GetEntryName(entries, id, fullStack)].Add(idTotals);
+    }
+
+    return totals;
 }
 
 void PerformanceMonitor::PrintStats(bool perTick, bool fullStack)
 {
+    std::map<PerformanceMetric, std::map<std::string, PerformanceTotals>> data = Collect(fullStack);
     if (data.empty())
         return;
 
@@ -58,48 +333,27 @@ void PerformanceMonitor::PrintStats(bool perTick, bool fullStack)
         float updateAITotalTime = 0;
         for (auto& map : data[PERF_MON_TOTAL])
             if (map.first.find("PlayerbotAI::UpdateAIInternal") != std::string::npos)
-                updateAITotalTime += map.second->totalTime;
+                updateAITotalTime += map.second.totalTime;
 
         LOG_INFO(
             "playerbots",
-            "--------------------------------------[TOTAL BOT]------------------------------------------------------");
+            "--------------------------------------[TOTAL BOT]-------"
+            "--------------------------------------------------------");
         LOG_INFO("playerbots",
-                 "percentage     time  |     min ..     max (      avg  of      count) - type      : name");
+                 "percentage     time  |     p50 ..     p99 ..     max (      avg  of      count) - type      : name");
         LOG_INFO(
             "playerbots",
-            "-------------------------------------------------------------------------------------------------------");
+            "--------------------------------------------------------"
+            "--------------------------------------------------------");
 
-        for (std::map<PerformanceMetric, std::map<std::string, PerformanceData*>>::iterator i = data.begin();
-             i != data.end(); ++i)
+        for (auto i = data.begin(); i != data.end(); ++i)
         {
-            std::map<std::string, PerformanceData*> pdMap = i->second;
-
-            std::string key;
-            switch (i->first)
-            {
-                case PERF_MON_TRIGGER:
-                    key = "Trigger";
-                    break;
-                case PERF_MON_VALUE:
-                    key = "Value";
-                    break;
-                case PERF_MON_ACTION:
-                    key = "Action";
-                    break;
-                case PERF_MON_RNDBOT:
-                    key = "RndBot";
-                    break;
-                case PERF_MON_TOTAL:
-                    key = "Total";
-                    break;
-                default:
-                    key = "?";
-                    break;
-            }
+            std::map<std::string, PerformanceTotals>& pdMap = i->second;
+            std::string key = GetMetricName(i->first);
 
             std::vector<std::string> names;
 
-            for (std::map<std::string, PerformanceData*>::iterator j = pdMap.begin(); j != pdMap.end(); ++j)
+            for (auto j = pdMap.begin(); j != pdMap.end(); ++j)
             {
                 if (key == "Total" && j->first.find("PlayerbotAI::UpdateAIInternal") == std::string::npos)
                     continue;
@@ -108,196 +362,199 @@ void PerformanceMonitor::PrintStats(bool perTick, bool fullStack)
             }
 
             std::sort(names.begin(), names.end(),
-                      [pdMap](std::string const i, std::string const j)
-                      { return pdMap.at(i)->totalTime < pdMap.at(j)->totalTime; });
+                      [&pdMap](std::string const& i, std::string const& j)
+                      { return pdMap.at(i).totalTime < pdMap.at(j).totalTime; });
 
-            uint64 typeTotalTime = 0;
-            uint64 typeMinTime = 0xffffffffu;
-            uint64 typeMaxTime = 0;
-            uint32 typeCount = 0;
+            PerformanceTotals typeTotals;
             for (auto& name : names)
             {
-                PerformanceData* pd = pdMap[name];
-                typeTotalTime += pd->totalTime;
-                typeCount += pd->count;
-                if (typeMinTime > pd->minTime)
-                    typeMinTime = pd->minTime;
-                if (typeMaxTime < pd->maxTime)
-                    typeMaxTime = pd->maxTime;
-                float perc = (float)pd->totalTime / updateAITotalTime * 100.0f;
-                float time = (float)pd->totalTime / 1000000.0f;
-                float minTime = (float)pd->minTime / 1000.0f;
-                float maxTime = (float)pd->maxTime / 1000.0f;
-                float avg = (float)pd->totalTime / (float)pd->count / 1000.0f;
-                std::string disName = name;
-                if (!fullStack && disName.find("|") != std::string::npos)
-                    disName = disName.substr(0, disName.find("|")) + "]";
-
-                if (perc >= 0.1f || avg >= 0.25f || pd->maxTime > 1000)
+                PerformanceTotals const& pd = pdMap[name];
+                typeTotals.Add(pd);
+                float perc = (float)pd.totalTime / updateAITotalTime * 100.0f;
+                float time = (float)pd.totalTime / 1000000.0f;
+                float p50 = (float)pd.Percentile(50) / 1000.0f;
+                float p99 = (float)pd.Percentile(99) / 1000.0f;
+                float maxTime = (float)pd.maxTime / 1000.0f;
+                float avg = (float)pd.totalTime / (float)pd.count / 1000.0f;
+
+                if (perc >= 0.1f || avg >= 0.25f || pd.maxTime > 1000)
                 {
                     LOG_INFO("playerbots",
-                             "{:7.3f}% {:10.3f}s | {:7.1f} .. {:7.1f} ({:10.3f} of {:10d}) - {:6}    : {}", perc, time,
-                             minTime, maxTime, avg, pd->count, key.c_str(), disName.c_str());
+                             "{:7.3f}% {:10.3f}s | {:7.1f} .. {:7.1f} .. {:7.1f} ({:10.3f} of {:10d}) - {:6}    : {}",
+                             perc, time, p50, p99, maxTime, avg, pd.count, key.c_str(), name.c_str());
                 }
             }
-            float tPerc = (float)typeTotalTime / (float)updateAITotalTime * 100.0f;
-            float tTime = (float)typeTotalTime / 1000000.0f;
-            float tMinTime = (float)typeMinTime / 1000.0f;
-            float tMaxTime = (float)typeMaxTime / 1000.0f;
-            float tAvg = (float)typeTotalTime / (float)typeCount / 1000.0f;
-            LOG_INFO("playerbots", "{:7.3f}% {:10.3f}s | {:7.1f} .. {:7.1f} ({:10.3f} of {:10d}) - {:6}    : {}", tPerc,
-                     tTime, tMinTime, tMaxTime, tAvg, typeCount, key.c_str(), "Total");
+            float tPerc = (float)typeTotals.totalTime / (float)updateAITotalTime * 100.0f;
+            float tTime = (float)typeTotals.totalTime / 1000000.0f;
+            float tP50 = (float)typeTotals.Percentile(50) / 1000.0f;
+            float tP99 = (float)typeTotals.Percentile(99) / 1000.0f;
+            float tMaxTime = (float)typeTotals.maxTime / 1000.0f;
+            float tAvg = (float)typeTotals.totalTime / (float)typeTotals.count / 1000.0f;
+            LOG_INFO("playerbots",
+                     "{:7.3f}% {:10.3f}s | {:7.1f} .. {:7.1f} .. {:7.1f} ({:10.3f} of {:10d}) - {:6}    : {}", tPerc,
+                     tTime, tP50, tP99, tMaxTime, tAvg, typeTotals.count, key.c_str(), "Total");
             LOG_INFO("playerbots", " ");
         }
     }
     else
     {
-        float fullTickCount = data[PERF_MON_TOTAL]["PlayerbotAIBase::FullTick"]->count;
-        float fullTickTotalTime = data[PERF_MON_TOTAL]["PlayerbotAIBase::FullTick"]->totalTime;
+        PerformanceTotals const& fullTick = data[PERF_MON_TOTAL]["PlayerbotAIBase::FullTick"];
+        if (!fullTick.count)
+            return;
+
+        float fullTickCount = fullTick.count;
+        float fullTickTotalTime = fullTick.totalTime;
 
         LOG_INFO(
             "playerbots",
-            "---------------------------------------[PER TICK]------------------------------------------------------");
+            "---------------------------------------[PER TICK]-------"
+            "--------------------------------------------------------");
         LOG_INFO("playerbots",
-                 "percentage     time  |     min ..     max (      avg  of      count) - type      : name");
+                 "percentage     time  |     p50 ..     p99 ..     max (      avg  of      count) - type      : name");
         LOG_INFO(
             "playerbots",
-            "-------------------------------------------------------------------------------------------------------");
+            "--------------------------------------------------------"
+            "--------------------------------------------------------");
 
-        for (std::map<PerformanceMetric, std::map<std::string, PerformanceData*>>::iterator i = data.begin();
-             i != data.end(); ++i)
+        for (auto i = data.begin(); i != data.end(); ++i)
         {
-            std::map<std::string, PerformanceData*> pdMap = i->second;
-
-            std::string key;
-            switch (i->first)
-            {
-                case PERF_MON_TRIGGER:
-                    key = "Trigger";
-                    break;
-                case PERF_MON_VALUE:
-                    key = "Value";
-                    break;
-                case PERF_MON_ACTION:
-                    key = "Action";
-                    break;
-                case PERF_MON_RNDBOT:
-                    key = "RndBot";
-                    break;
-                case PERF_MON_TOTAL:
-                    key = "Total";
-                    break;
-                default:
-                    key = "?";
-            }
+            std::map<std::string, PerformanceTotals>& pdMap = i->second;
+            std::string key = GetMetricName(i->first);
 
             std::vector<std::string> names;
 
-            for (std::map<std::string, PerformanceData*>::iterator j = pdMap.begin(); j != pdMap.end(); ++j)
+            for (auto j = pdMap.begin(); j != pdMap.end(); ++j)
             {
                 names.push_back(j->first);
             }
 
             std::sort(names.begin(), names.end(),
-                      [pdMap](std::string const i, std::string const j)
-                      { return pdMap.at(i)->totalTime < pdMap.at(j)->totalTime; });
+                      [&pdMap](std::string const& i, std::string const& j)
+                      { return pdMap.at(i).totalTime < pdMap.at(j).totalTime; });
 
-            uint64 typeTotalTime = 0;
-            uint64 typeMinTime = 0xffffffffu;
-            uint64 typeMaxTime = 0;
-            uint32 typeCount = 0;
+            PerformanceTotals typeTotals;
             for (auto& name : names)
             {
-                PerformanceData* pd = pdMap[name];
-                typeTotalTime += pd->totalTime;
-                typeCount += pd->count;
-                if (typeMinTime > pd->minTime)
-                    typeMinTime = pd->minTime;
-                if (typeMaxTime < pd->maxTime)
-                    typeMaxTime = pd->maxTime;
-                float perc = (float)pd->totalTime / fullTickTotalTime * 100.0f;
-                float time = (float)pd->totalTime / fullTickCount / 1000.0f;
-                float minTime = (float)pd->minTime / 1000.0f;
-                float maxTime = (float)pd->maxTime / 1000.0f;
-                float avg = (float)pd->totalTime / (float)pd->count / 1000.0f;
-                float amount = (float)pd->count / fullTickCount;
-                std::string disName = name;
-                if (!fullStack && disName.find("|") != std::string::npos)
-                    disName = disName.substr(0, disName.find("|")) + "]";
-                if (perc >= 0.1f || avg >= 0.25f || pd->maxTime > 1000)
+                PerformanceTotals const& pd = pdMap[name];
+                typeTotals.Add(pd);
+                float perc = (float)pd.totalTime / fullTickTotalTime * 100.0f;
+                float time = (float)pd.totalTime / fullTickCount / 1000.0f;
+                float p50 = (float)pd.Percentile(50) / 1000.0f;
+                float p99 = (float)pd.Percentile(99) / 1000.0f;
+                float maxTime = (float)pd.maxTime / 1000.0f;
+                float avg = (float)pd.totalTime / (float)pd.count / 1000.0f;
+                float amount = (float)pd.count / fullTickCount;
+                if (perc >= 0.1f || avg >= 0.25f || pd.maxTime > 1000)
                 {
                     LOG_INFO("playerbots",
-                             "{:7.3f}% {:9.3f}ms | {:7.1f} .. {:7.1f} ({:10.3f} of {:10.2f}) - {:6}    : {}", perc,
-                             time, minTime, maxTime, avg, amount, key.c_str(), disName.c_str());
+                             "{:7.3f}% {:9.3f}ms | {:7.1f} .. {:7.1f} .. {:7.1f} ({:10.3f} of {:10.2f}) - {:6}    : {}",
+                             perc, time, p50, p99, maxTime, avg, amount, key.c_str(), name.c_str());
                 }
             }
             if (i->first != PERF_MON_TOTAL)
             {
-                float tPerc = (float)typeTotalTime / (float)fullTickTotalTime * 100.0f;
-                float tTime = (float)typeTotalTime / fullTickCount / 1000.0f;
-                float tMinTime = (float)typeMinTime / 1000.0f;
-                float tMaxTime = (float)typeMaxTime / 1000.0f;
-                float tAvg = (float)typeTotalTime / (float)typeCount / 1000.0f;
-                float tAmount = (float)typeCount / fullTickCount;
-                LOG_INFO("playerbots", "{:7.3f}% {:9.3f}ms | {:7.1f} .. {:7.1f} ({:10.3f} of {:10.2f}) - {:6}    : {}",
-                         tPerc, tTime, tMinTime, tMaxTime, tAvg, tAmount, key.c_str(), "Total");
+                float tPerc = (float)typeTotals.totalTime / (float)fullTickTotalTime * 100.0f;
+                float tTime = (float)typeTotals.totalTime / fullTickCount / 1000.0f;
+                float tP50 = (float)typeTotals.Percentile(50) / 1000.0f;
+                float tP99 = (float)typeTotals.Percentile(99) / 1000.0f;
+                float tMaxTime = (float)typeTotals.maxTime / 1000.0f;
+                float tAvg = (float)typeTotals.totalTime / (float)typeTotals.count / 1000.0f;
+                float tAmount = (float)typeTotals.count / fullTickCount;
+                LOG_INFO("playerbots",
+                         "{:7.3f}% {:9.3f}ms | {:7.1f} .. {:7.1f} .. {:7.1f} ({:10.3f} of {:10.2f}) - {:6}    : {}",
+                         tPerc, tTime, tP50, tP99, tMaxTime, tAvg, tAmount, key.c_str(), "Total");
             }
             LOG_INFO("playerbots", " ");
         }
     }
+
+    PrintCounters();
 }
 
-void PerformanceMonitor::Reset()
+void PerformanceMonitor::LogMetrics()
 {
-    for (std::map<PerformanceMetric, std::map<std::string, PerformanceData*>>::iterator i = data.begin();
-         i != data.end(); ++i)
+    if (!IsEnabled() || !sMetric->IsEnabled())
+        return;
+
+    std::map<std::pair<PerformanceMetric, std::string>, PerformanceTotals> totals;
     {
-        std::map<std::string, PerformanceData*> pdMap = i->second;
-        for (std::map<std::string, PerformanceData*>::iterator j = pdMap.begin(); j != pdMap.end(); ++j)
+        std::lock_guard<std::mutex> guard(lock);
+        for (uint32 id = 1; id < entries.size(); ++id)
         {
-            PerformanceData* pd = j->second;
-            std::lock_guard<std::mutex> guard(pd->lock);
-            pd->minTime = 0;
-            pd->maxTime = 0;
-            pd->totalTime = 0;
-            pd->count = 0;
+            PerformanceTotals& scopeTotals = totals[std::make_pair(entries[id].metric, entries[id].name)];
+            for (std::unique_ptr<PerformanceShard> const& shard : shards)
+            {
+                if (PerformanceData const* data = shard->Find(id))
+                    scopeTotals.Add(*data);
+            }
         }
     }
-}
 
-PerformanceMonitorOperation::PerformanceMonitorOperation(PerformanceData* data, std::string const name,
-                                                         PerformanceStack* stack)
-    : data(data), name(name), stack(stack)
-{
-    started = (std::chrono::time_point_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now()))
-                  .time_since_epoch();
+    for (auto const& scope : totals)
+    {
+        if (!scope.second.count)
+            continue;
+
+        std::vector<MetricTag> tags = {{"type", GetMetricName(scope.first.first)}, {"name", scope.first.second}};
+        sMetric->LogValue("playerbots_perf_count", scope.second.count, tags);
+        sMetric->LogValue("playerbots_perf_time", scope.second.totalTime, tags);
+        sMetric->LogValue("playerbots_perf_p50", scope.second.Percentile(50), tags);
+        sMetric->LogValue("playerbots_perf_p99", scope.second.Percentile(99), tags);
+        sMetric->LogValue("playerbots_perf_max", scope.second.maxTime, tags);
+    }
 }
 
-void PerformanceMonitorOperation::finish()
+void PerformanceMonitor::PrintCounters()
 {
-    std::chrono::microseconds finished =
-        (std::chrono::time_point_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now()))
-            .time_since_epoch();
-    uint64 elapsed = (finished - started).count();
-
-    std::lock_guard<std::mutex> guard(data->lock);
-    if (elapsed > 0)
+    // counters are never deleted, only the map is guarded
+    std::vector<std::pair<std::string, PerformanceCounter*>> counters;
     {
-        if (!data->minTime || data->minTime > elapsed)
-            data->minTime = elapsed;
+        std::lock_guard<std::mutex> guard(lock);
+        counters.assign(this->counters.begin(), this->counters.end());
+    }
+
+    if (counters.empty())
+        return;
 
-        if (!data->maxTime || data->maxTime < elapsed)
-            data->maxTime = elapsed;
+    LOG_INFO(
+        "playerbots",
+        "---------------------------------------[CACHES]--------------------------------------------------------");
+    LOG_INFO("playerbots", "hit rate  |       hits ..     misses - name");
 
-        data->totalTime += elapsed;
+    for (auto& counter : counters)
+    {
+        uint64 hits = counter.second->hits;
+        uint64 misses = counter.second->misses;
+        float hitRate = hits + misses ? (float)hits / (float)(hits + misses) * 100.0f : 0.0f;
+        LOG_INFO("playerbots", "{:7.3f}%  | {:10d} .. {:10d} - {}", hitRate, hits, misses, counter.first.c_str());
     }
 
-    ++data->count;
+    LOG_INFO("playerbots", " ");
+}
 
-    if (stack)
+void PerformanceMonitor::Reset()
+{
+    // a sample taken by another thread while resetting may survive in parts
+    std::lock_guard<std::mutex> guard(lock);
+    for (std::unique_ptr<PerformanceShard>& shard : shards)
     {
-        stack->erase(std::remove(stack->begin(), stack->end(), name), stack->end());
+        for (uint32 id = 1; id < entries.size(); ++id)
+        {
+            PerformanceData* data = const_cast<PerformanceData*>(shard->Find(id));
+            if (!data)
+                continue;
+
+            data->totalTime = 0;
+            data->maxTime = 0;
+            data->count = 0;
+            for (std::atomic<uint32>& bucket : data->buckets)
+                bucket = 0;
+        }
     }
 
-    delete this;
+    for (auto& counter : counters)
+    {
+        counter.second->hits = 0;
+        counter.second->misses = 0;
+    }
 }
@@ -6,23 +6,56 @@
 #ifndef _PLAYERBOT_PERFORMANCEMONITOR_H
 #define _PLAYERBOT_PERFORMANCEMONITOR_H
 
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <ctime>
 #include <map>
+#include <memory>
 #include <mutex>
+#include <unordered_map>
 #include <vector>
 
 #include "Common.h"
 
-typedef std::vector<std::string> PerformanceStack;
+// samples are sorted into buckets by the bit width of their time in microseconds
+#define PERF_MON_BUCKETS 32
+#define PERF_MON_CHUNK_SIZE 256
+#define PERF_MON_MAX_CHUNKS 1024
 
+class AiNamedObject;
+
+// ids of the measured scopes a bot is currently in, innermost last
+typedef std::vector<uint32> PerformanceStack;
+
+// Samples of one measured scope taken by one thread. Only that thread writes, printing may read at any time.
 struct PerformanceData
 {
-    uint64 minTime;
-    uint64 maxTime;
-    uint64 totalTime;
-    uint32 count;
-    std::mutex lock;
+    std::atomic<uint64> totalTime;
+    std::atomic<uint64> maxTime;
+    std::atomic<uint32> count;
+    std::atomic<uint32> buckets[PERF_MON_BUCKETS];
+};
+
+// Samples of one measured scope of all threads
+struct PerformanceTotals
+{
+    uint64 totalTime = 0;
+    uint64 maxTime = 0;
+    uint64 count = 0;
+    uint64 buckets[PERF_MON_BUCKETS] = {};
+
+    void Add(PerformanceData const& data);
+    void Add(PerformanceTotals const& totals);
+    // upper bound of the bucket holding the given percentile, in microseconds
+    uint64 Percentile(uint32 percentile) const;
+};
+
+// Hits and misses of a cache, only counted while the performance monitor is enabled
+struct PerformanceCounter
+{
+    std::atomic<uint64> hits = 0;
+    std::atomic<uint64> misses = 0;
 };
 
 enum PerformanceMetric
@@ -31,26 +64,74 @@ enum PerformanceMetric
     PERF_MON_VALUE,
     PERF_MON_ACTION,
     PERF_MON_RNDBOT,
-    PERF_MON_TOTAL
+    PERF_MON_TOTAL,
+    MAX_PERF_MON_METRIC
 };
 
-class PerformanceMonitorOperation
+// What a measured scope is called and which scope it was entered from
+struct PerformanceEntry
+{
+    PerformanceMetric metric;
+    std::string name;
+    uint32 parent;
+};
+
+// Samples of one thread, grown in chunks so printing never sees a chunk move
+class PerformanceShard
+{
+public:
+    PerformanceShard();
+    ~PerformanceShard();
+
+    PerformanceData* Get(uint32 id);
+    PerformanceData const* Find(uint32 id) const;
+
+private:
+    std::array<std::atomic<PerformanceData*>, PERF_MON_MAX_CHUNKS> chunks;
+};
+
+// Measures the time until it goes out of scope, does nothing while the performance monitor is disabled
+class PerformanceMonitorScope
 {
 public:
-    PerformanceMonitorOperation(PerformanceData* data, std::string const name, PerformanceStack* stack);
+    PerformanceMonitorScope(PerformanceMetric metric, std::string const& name, PerformanceStack* stack = nullptr);
+    PerformanceMonitorScope(PerformanceMetric metric, AiNamedObject* object, PerformanceStack* stack = nullptr);
+    // id from PerformanceMonitor::GetId, 0 measures nothing
+    PerformanceMonitorScope(uint32 id);
+    ~PerformanceMonitorScope() { finish(); }
+
+    PerformanceMonitorScope(PerformanceMonitorScope const&) = delete;
+    PerformanceMonitorScope& operator=(PerformanceMonitorScope const&) = delete;
+
     void finish();
 
 private:
-    PerformanceData* data;
-    std::string const name;
+    void Start(uint32 leafId, PerformanceStack* stack);
+
+    uint32 id;
     PerformanceStack* stack;
-    std::chrono::microseconds started;
+    std::chrono::steady_clock::time_point started;
+};
+
+// Heap allocated scope for measurements that do not end in the block they start in
+class PerformanceMonitorOperation
+{
+public:
+    PerformanceMonitorOperation(PerformanceMetric metric, std::string const name, PerformanceStack* stack)
+        : scope(metric, name, stack)
+    {
+    }
+
+    void finish();
+
+private:
+    PerformanceMonitorScope scope;
 };
 
 class PerformanceMonitor
 {
 public:
-    PerformanceMonitor(){};
+    PerformanceMonitor();
     virtual ~PerformanceMonitor(){};
     static PerformanceMonitor* instance()
     {
@@ -61,11 +142,28 @@ public:
 public:
     PerformanceMonitorOperation* start(PerformanceMetric metric, std::string const name,
                                        PerformanceStack* stack = nullptr);
+    bool IsEnabled() const;
+    uint32 GetId(PerformanceMetric metric, std::string const& name);
+    uint32 GetId(uint32 parent, uint32 leafId);
+    void AddSample(uint32 id, uint64 elapsed);
+    PerformanceCounter* GetCounter(std::string const name);
     void PrintStats(bool perTick = false, bool fullStack = false);
     void Reset();
+    // sends totals per type and scope to the core metric, stacks are left out to keep the series few
+    void LogMetrics();
 
 private:
-    std::map<PerformanceMetric, std::map<std::string, PerformanceData*> > data;
+    uint32 AddEntry(PerformanceMetric metric, std::string const& name, uint32 parent);
+    PerformanceShard* GetShard();
+    std::map<PerformanceMetric, std::map<std::string, PerformanceTotals>> Collect(bool fullStack);
+    void PrintCounters();
+
+    // entry 0 stands for nothing measured
+    std::vector<PerformanceEntry> entries;
+    std::map<std::pair<PerformanceMetric, std::string>, uint32> leafIds;
+    std::map<std::pair<uint32, uint32>, uint32> pathIds;
+    std::vector<std::unique_ptr<PerformanceShard>> shards;
+    std::map<std::string, PerformanceCounter*> counters;
     std::mutex lock;
 };
 
@@ -70,6 +70,50 @@ uint32 PlayerbotChatHandler::extractQuestId(std::string const str)
     return cId ? atol(cId) : 0;
 }
 
+static ObjectGuid ReadPackedGuid(WorldPacket const& packet, std::size_t& pos)
+{
+    uint8 mask = packet.read<uint8>(pos++);
+    uint64 guid = 0;
+    for (uint8 i = 0; i < 8; ++i)
+    {
+        if (mask & (1 << i))
+            guid |= uint64(packet.read<uint8>(pos++)) << (i * 8);
+    }
+
+    return ObjectGuid(guid);
+}
+
+PacketHeader::PacketHeader(WorldPacket const& packet) : opcode(packet.GetOpcode()), payload(0)
+{
+    switch (opcode)
+    {
+        case SMSG_SPELL_FAILURE:
+        case SMSG_SPELL_DELAYED:
+        case SMSG_MOVE_KNOCK_BACK:
+            guid = ReadPackedGuid(packet, payload);
+            break;
+        case SMSG_EMOTE:
+            guid = ObjectGuid(packet.read<uint64>(4));
+            payload = 12;
+            break;
+        case SMSG_MESSAGECHAT:
+        case SMSG_GM_MESSAGECHAT:
+            guid = ObjectGuid(packet.read<uint64>(5));
+            payload = 13;
+            break;
+        default:
+            break;
+    }
+}
+
+std::shared_ptr<WorldPacket const> const& SharedPacket::Get()
+{
+    if (!shared)
+        shared = std::make_shared<WorldPacket const>(packet);
+
+    return shared;
+}
+
 void PacketHandlingHelper::AddHandler(uint16 opcode, std::string const handler) { handlers[opcode] = handler; }
 
 void PacketHandlingHelper::Handle(ExternalEventHelper& helper)
@@ -82,14 +126,27 @@ void PacketHandlingHelper::Handle(ExternalEventHelper& helper)
 }
 
 void PacketHandlingHelper::AddPacket(WorldPacket const& packet)
+{
+    SharedPacket shared(packet);
+    AddPacket(shared);
+}
+
+void PacketHandlingHelper::AddPacket(SharedPacket& packet)
 {
     if (packet.empty())
         return;
-    // assert(handlers);
-    // assert(packet);
-    // assert(packet.GetOpcode());
+
     if (handlers.find(packet.GetOpcode()) != handlers.end())
-        queue.push(WorldPacket(packet));
+        queue.push(packet.Get());
+}
+
+void PacketHandlingHelper::AddOpcodes(std::bitset<NUM_MSG_TYPES>& opcodes) const
+{
+    for (auto const& handler : handlers)
+    {
+        if (handler.first < NUM_MSG_TYPES)
+            opcodes.set(handler.first);
+    }
 }
 
 PlayerbotAI::PlayerbotAI()
@@ -202,6 +259,16 @@ PlayerbotAI::PlayerbotAI(Player* bot)
     botOutgoingPacketHandlers.AddHandler(SMSG_QUESTUPDATE_ADD_KILL, "quest update add kill");
     botOutgoingPacketHandlers.AddHandler(SMSG_QUESTUPDATE_ADD_ITEM, "quest update add item");
     botOutgoingPacketHandlers.AddHandler(SMSG_QUEST_CONFIRM_ACCEPT, "confirm quest");
+
+    // bots have no client, whatever OnPlayerbotPacketSent does not read is never built for them
+    std::bitset<NUM_MSG_TYPES> consumedOpcodes;
+    botOutgoingPacketHandlers.AddOpcodes(consumedOpcodes);
+    // a bot may be the master of other bots, they read its packets too
+    masterOutgoingPacketHandlers.AddOpcodes(consumedOpcodes);
+    for (auto const& reader : botPacketReaders)
+        consumedOpcodes.set(reader.first);
+
+    bot->GetSession()->SetHeadlessOpcodes(consumedOpcodes);
 }
 
 PlayerbotAI::~PlayerbotAI()
@@ -486,14 +553,51 @@ void PlayerbotAI::UpdateAI(uint32 elapsed, bool minimal)
     YieldThread(GetReactDelay());
 }
 
+void PlayerbotAI::PrepareAI(uint32 elapsed)
+{
+    // mirrors the early outs of UpdateAI and DoNextAction, only bots about to run their engine are prepared
+    if (nextAICheckDelay > elapsed)
+        return;
+
+    if (!bot || !bot->IsInWorld() || bot->IsBeingTeleported() || bot->IsDuringRemoveFromWorld())
+        return;
+
+    if (!bot->GetSession() || bot->GetSession()->isLogingOut())
+        return;
+
+    if (bot->HasUnitState(UNIT_STATE_IN_FLIGHT) || bot->IsAlive() == (currentEngine == engines[BOT_STATE_DEAD]))
+        return;
+
+    if (bot->GetCurrentSpell(CURRENT_GENERIC_SPELL) || bot->GetCurrentSpell(CURRENT_CHANNELED_SPELL))
+        return;
+
+    // the activity check may look at other bots, the prepared pass uses its last result
+    currentEngine->PrepareTriggers(!allowActive[ALL_ACTIVITY]);
+}
+
+void PlayerbotAI::ClearPreparedTriggers()
+{
+    for (uint8 i = 0; i < BOT_STATE_MAX; i++)
+    {
+        if (engines[i])
+            engines[i]->ClearPreparedTriggers();
+    }
+}
+
 void PlayerbotAI::UpdateAIInternal([[maybe_unused]] uint32 elapsed, bool minimal)
 {
     if (bot->IsBeingTeleported() || !bot->IsInWorld())
         return;
 
-    std::string const mapString = WorldPosition(bot).isOverworld() ? std::to_string(bot->GetMapId()) : "I";
-    PerformanceMonitorOperation* pmo =
-        sPerformanceMonitor->start(PERF_MON_TOTAL, "PlayerbotAI::UpdateAIInternal " + mapString);
+    // the name of the measured scope is only built again when the bot enters another map
+    if (sPerformanceMonitor->IsEnabled() && performanceMapId != bot->GetMapId())
+    {
+        std::string const mapString = WorldPosition(bot).isOverworld() ? std::to_string(bot->GetMapId()) : "I";
+        performanceId = sPerformanceMonitor->GetId(PERF_MON_TOTAL, "PlayerbotAI::UpdateAIInternal " + mapString);
+        performanceMapId = bot->GetMapId();
+    }
+
+    PerformanceMonitorScope pms(performanceId);
     ExternalEventHelper helper(aiObjectContext);
 
     // chat replies
@@ -506,7 +610,8 @@ void PlayerbotAI::UpdateAIInternal([[maybe_unused]] uint32 elapsed, bool minimal
             continue;
         }
 
-        ChatReplyAction::ChatReplyDo(bot, it->m_type, it->m_guid1, it->m_guid2, it->m_msg, it->m_chanName, it->m_name);
+        ChatReplyAction::ChatReplyDo(bot, it->m_type, it->m_guid1, it->m_guid2, *it->m_message, it->m_chanName,
+                                     it->m_name);
         it = chatReplies.erase(it);
     }
 
@@ -559,9 +664,6 @@ void PlayerbotAI::UpdateAIInternal([[maybe_unused]] uint32 elapsed, bool minimal
     masterOutgoingPacketHandlers.Handle(helper);
 
     DoNextAction(minimal);
-
-    if (pmo)
-        pmo->finish();
 }
 
 void PlayerbotAI::HandleCommands()
@@ -884,6 +986,18 @@ bool PlayerbotAI::IsAllowedCommand(std::string const text)
 }
 
 void PlayerbotAI::HandleCommand(uint32 type, std::string const text, Player* fromPlayer)
+{
+    if (!fromPlayer)
+    {
+        HandleCommand(type, PlayerbotChatMessage(text), fromPlayer);
+        return;
+    }
+
+    // bots of a group or guild hear the same line, the first one parses it for all
+    HandleCommand(type, *sPlayerbotChatCache->Get(fromPlayer->GetGUID(), text), fromPlayer);
+}
+
+void PlayerbotAI::HandleCommand(uint32 type, PlayerbotChatMessage const& message, Player* fromPlayer)
 {
     if (!GetSecurity()->CheckLevelFor(PLAYERBOT_SECURITY_INVITE, type != CHAT_MSG_WHISPER, fromPlayer))
         return;
@@ -894,48 +1008,16 @@ void PlayerbotAI::HandleCommand(uint32 type, std::string const text, Player* fro
     if (type == CHAT_MSG_SYSTEM)
         return;
 
-    if (text.find(sPlayerbotAIConfig->commandSeparator) != std::string::npos)
-    {
-        std::vector<std::string> commands;
-        split(commands, text, sPlayerbotAIConfig->commandSeparator.c_str());
-        for (std::vector<std::string>::iterator i = commands.begin(); i != commands.end(); ++i)
-        {
-            HandleCommand(type, *i, fromPlayer);
-        }
-
-        return;
-    }
-
-    std::string filtered = text;
-    if (!sPlayerbotAIConfig->commandPrefix.empty())
-    {
-        if (filtered.find(sPlayerbotAIConfig->commandPrefix) != 0)
-            return;
-
-        filtered = filtered.substr(sPlayerbotAIConfig->commandPrefix.size());
-    }
-
-    if (chatMap.empty())
-    {
-        chatMap["#w "] = CHAT_MSG_WHISPER;
-        chatMap["#p "] = CHAT_MSG_PARTY;
-        chatMap["#r "] = CHAT_MSG_RAID;
-        chatMap["#a "] = CHAT_MSG_ADDON;
-        chatMap["#g "] = CHAT_MSG_GUILD;
-    }
+    for (PlayerbotChatCommand const& command : message.GetCommands())
+        HandleChatCommand(type, command, fromPlayer);
+}
 
-    currentChat = std::pair<ChatMsg, time_t>(CHAT_MSG_WHISPER, 0);
-    for (std::map<std::string, ChatMsg>::iterator i = chatMap.begin(); i != chatMap.end(); ++i)
-    {
-        if (filtered.find(i->first) == 0)
-        {
-            filtered = filtered.substr(3);
-            currentChat = std::pair<ChatMsg, time_t>(i->second, time(nullptr) + 2);
-            break;
-        }
-    }
+void PlayerbotAI::HandleChatCommand(uint32 type, PlayerbotChatCommand const& command, Player* fromPlayer)
+{
+    currentChat = std::pair<ChatMsg, time_t>(command.replyChat, command.hasReplyChat ? time(nullptr) + 2 : 0);
 
-    filtered = chatFilter.Filter(trim(filtered));
+    std::string filtered = command.text;
+    filtered = chatFilter.Filter(filtered);
     if (filtered.empty())
         return;
 
@@ -1022,6 +1104,15 @@ void PlayerbotAI::HandleCommand(uint32 type, std::string const text, Player* fro
     }
 }
 
+// opcodes the bot AI reads in place instead of queueing them for the packet handler actions
+std::map<uint16, PlayerbotAI::BotPacketReader> const PlayerbotAI::botPacketReaders = {
+    {SMSG_SPELL_FAILURE, &PlayerbotAI::HandleBotSpellFailure},
+    {SMSG_SPELL_DELAYED, &PlayerbotAI::HandleBotSpellDelayed},
+    {SMSG_EMOTE, &PlayerbotAI::HandleBotEmote},
+    {SMSG_MESSAGECHAT, &PlayerbotAI::HandleBotChat},
+    {SMSG_MOVE_KNOCK_BACK, &PlayerbotAI::HandleBotKnockBack},
+};
+
 void PlayerbotAI::HandleBotOutgoingPacket(WorldPacket const& packet)
 {
     if (packet.empty())
@@ -1030,250 +1121,249 @@ void PlayerbotAI::HandleBotOutgoingPacket(WorldPacket const& packet)
     {
         return;
     }
-    switch (packet.GetOpcode())
+    PacketHeader header(packet);
+    auto reader = botPacketReaders.find(header.opcode);
+    if (reader == botPacketReaders.end())
     {
-        case SMSG_SPELL_FAILURE:
+        botOutgoingPacketHandlers.AddPacket(packet);
+        return;
+    }
+
+    (this->*reader->second)(packet, header);
+}
+
+void PlayerbotAI::HandleBotSpellFailure(WorldPacket const& packet, PacketHeader const& header)
+{
+    if (header.guid != bot->GetGUID())
+        return;
+
+    uint32 spellId = packet.read<uint32>(header.payload + 1);
+    SpellInterrupted(spellId);
+}
+
+void PlayerbotAI::HandleBotSpellDelayed(WorldPacket const& packet, PacketHeader const& header)
+{
+    if (header.guid != bot->GetGUID())
+        return;
+
+    uint32 delaytime = packet.read<uint32>(header.payload);
+    if (delaytime <= 1000)
+        IncreaseNextCheckDelay(delaytime);
+}
+
+void PlayerbotAI::HandleBotEmote(WorldPacket const& packet, PacketHeader const& header)
+{
+    // do not react to NPC emotes
+    if (header.guid.IsPlayer())
+        botOutgoingPacketHandlers.AddPacket(packet);
+}
+
+void PlayerbotAI::HandleBotChat(WorldPacket const& packet, PacketHeader const& header)
+{
+    // do not react to self or if not ready to reply
+    if (!sPlayerbotAIConfig->randomBotTalk)
+        return;
+
+    if (!AllowActivity())
+        return;
+
+    // own and oversized messages are never answered, no need to copy them
+    if (header.guid.IsEmpty() || header.guid == bot->GetGUID() || packet.size() > packet.DEFAULT_SIZE)
+        return;
+
+    if (!packet.empty() && (packet.GetOpcode() == SMSG_MESSAGECHAT || packet.GetOpcode() == SMSG_GM_MESSAGECHAT))
+    {
+        // type, language, sender and an unused uint32, read in place instead of copying the packet
+        uint8 msgtype = packet.read<uint8>(0);
+        uint32 lang = packet.read<uint32>(1);
+        ObjectGuid guid1 = ObjectGuid(packet.read<uint64>(5));
+        ObjectGuid guid2;
+        std::string name = "";
+        std::string chanName = "";
+        std::string message = "";
+
+        std::size_t pos = 17;
+        auto readString = [&packet, &pos]()
         {
-            WorldPacket p(packet);
-            p.rpos(0);
-            ObjectGuid casterGuid;
-            p >> casterGuid.ReadAsPacked();
-            if (casterGuid != bot->GetGUID())
-                return;
-            uint8 count, result;
-            uint32 spellId;
-            p >> count >> spellId >> result;
-            SpellInterrupted(spellId);
-            return;
+            if (pos >= packet.size())
+                return std::string();
+
+            char const* start = reinterpret_cast<char const*>(packet.contents()) + pos;
+            std::size_t length = strnlen(start, packet.size() - pos);
+            pos += length + 1;
+            return std::string(start, length);
+        };
+
+        if (packet.GetOpcode() == SMSG_GM_MESSAGECHAT)
+        {
+            // the name length
+            pos += 4;
+            name = readString();
         }
-        case SMSG_SPELL_DELAYED:
+
+        switch (msgtype)
         {
-            WorldPacket p(packet);
-            p.rpos(0);
-            ObjectGuid casterGuid;
-            p >> casterGuid.ReadAsPacked();
-            if (casterGuid != bot->GetGUID())
+            case CHAT_MSG_CHANNEL:
+                chanName = readString();
+                [[fallthrough]];
+            case CHAT_MSG_SAY:
+            case CHAT_MSG_PARTY:
+            case CHAT_MSG_YELL:
+            case CHAT_MSG_WHISPER:
+            case CHAT_MSG_GUILD:
+                guid2 = ObjectGuid(packet.read<uint64>(pos));
+                // the text length follows the receiver, the chat tag after the text is not used
+                pos += 12;
+                message = readString();
+                break;
+            default:
                 return;
-
-            uint32 delaytime;
-            p >> delaytime;
-            if (delaytime <= 1000)
-                IncreaseNextCheckDelay(delaytime);
-            return;
         }
-        case SMSG_EMOTE:  // do not react to NPC emotes
-        {
-            WorldPacket p(packet);
-            ObjectGuid source;
-            uint32 emoteId;
-            p.rpos(0);
-            p >> emoteId >> source;
-            if (source.IsPlayer())
-                botOutgoingPacketHandlers.AddPacket(packet);
 
-            return;
-        }
-        case SMSG_MESSAGECHAT:  // do not react to self or if not ready to reply
+        // do not reply to self but always try to reply to real player
+        if (guid1 != bot->GetGUID())
         {
-            if (!sPlayerbotAIConfig->randomBotTalk)
+            time_t lastChat = GetAiObjectContext()->GetValue<time_t>("last said", "chat")->Get();
+            bool isPaused = time(0) < lastChat;
+            bool shouldReply = false;
+            bool isFromFreeBot = false;
+            sCharacterCache->GetCharacterNameByGuid(guid1, name);
+            uint32 accountId = sCharacterCache->GetCharacterAccountIdByGuid(guid1);
+            isFromFreeBot = sPlayerbotAIConfig->IsInRandomAccountList(accountId);
+            bool isMentioned = message.find(bot->GetName()) != std::string::npos;
+
+            ChatChannelSource chatChannelSource = GetChatChannelSource(bot, msgtype, chanName);
+
+            // random bot speaks, chat CD
+            if (isFromFreeBot && isPaused)
+                return;
+
+            // BG: react only if mentioned or if not channel and real player spoke
+            if (bot->InBattleground() && !(isMentioned || (msgtype != CHAT_MSG_CHANNEL && !isFromFreeBot)))
                 return;
 
-            if (!AllowActivity())
+            if (HasRealPlayerMaster() && guid1 != GetMaster()->GetGUID())
+                return;
+            if (lang == LANG_ADDON)
                 return;
 
-            WorldPacket p(packet);
-            if (!p.empty() && (p.GetOpcode() == SMSG_MESSAGECHAT || p.GetOpcode() == SMSG_GM_MESSAGECHAT))
+            // every bot hearing the line shares one parse of it
+            std::shared_ptr<PlayerbotChatMessage const> parsed = sPlayerbotChatCache->Get(guid1, message);
+            if (parsed->IsToxicLinks() && sPlayerbotAIConfig->toxicLinksRepliesChance)
             {
-                p.rpos(0);
-                uint8 msgtype, chatTag;
-                uint32 lang, textLen, nameLen, unused;
-                ObjectGuid guid1, guid2;
-                std::string name = "";
-                std::string chanName = "";
-                std::string message = "";
-
-                p >> msgtype >> lang;
-                p >> guid1 >> unused;
-                if (guid1.IsEmpty() || p.size() > p.DEFAULT_SIZE)
+                if (urand(0, 50) > 0 || urand(1, 100) > sPlayerbotAIConfig->toxicLinksRepliesChance)
+                {
                     return;
-
-                if (p.GetOpcode() == SMSG_GM_MESSAGECHAT)
+                }
+            }
+            else if (parsed->GetItemIds().count(19019) && sPlayerbotAIConfig->thunderfuryRepliesChance)
+            {
+                if (urand(0, 60) > 0 || urand(1, 100) > sPlayerbotAIConfig->thunderfuryRepliesChance)
                 {
-                    p >> textLen;
-                    p >> name;
+                    return;
                 }
+            }
+            else
+            {
+                if (isFromFreeBot && urand(0, 20))
+                    return;
 
-                switch (msgtype)
+                // if (msgtype == CHAT_MSG_GUILD && (!sPlayerbotAIConfig->guildRepliesRate || urand(1, 100) >=
+                // sPlayerbotAIConfig->guildRepliesRate)) return;
+
+                if (!isFromFreeBot)
                 {
-                    case CHAT_MSG_CHANNEL:
-                        p >> chanName;
-                        [[fallthrough]];
-                    case CHAT_MSG_SAY:
-                    case CHAT_MSG_PARTY:
-                    case CHAT_MSG_YELL:
-                    case CHAT_MSG_WHISPER:
-                    case CHAT_MSG_GUILD:
-                        p >> guid2;
-                        p >> textLen >> message >> chatTag;
-                        break;
-                    default:
+                    if (!isMentioned && urand(0, 4))
                         return;
                 }
-
-                // do not reply to self but always try to reply to real player
-                if (guid1 != bot->GetGUID())
+                else
                 {
-                    time_t lastChat = GetAiObjectContext()->GetValue<time_t>("last said", "chat")->Get();
-                    bool isPaused = time(0) < lastChat;
-                    bool shouldReply = false;
-                    bool isFromFreeBot = false;
-                    sCharacterCache->GetCharacterNameByGuid(guid1, name);
-                    uint32 accountId = sCharacterCache->GetCharacterAccountIdByGuid(guid1);
-                    isFromFreeBot = sPlayerbotAIConfig->IsInRandomAccountList(accountId);
-                    bool isMentioned = message.find(bot->GetName()) != std::string::npos;
-
-                    ChatChannelSource chatChannelSource = GetChatChannelSource(bot, msgtype, chanName);
-
-                    // random bot speaks, chat CD
-                    if (isFromFreeBot && isPaused)
-                        return;
-
-                    // BG: react only if mentioned or if not channel and real player spoke
-                    if (bot->InBattleground() && !(isMentioned || (msgtype != CHAT_MSG_CHANNEL && !isFromFreeBot)))
+                    if (urand(0, 20 + 10 * isMentioned))
                         return;
-
-                    if (HasRealPlayerMaster() && guid1 != GetMaster()->GetGUID())
-                        return;
-                    if (lang == LANG_ADDON)
-                        return;
-
-                    if (message.starts_with(sPlayerbotAIConfig->toxicLinksPrefix) &&
-                        (GetChatHelper()->ExtractAllItemIds(message).size() > 0 ||
-                        GetChatHelper()->ExtractAllQuestIds(message).size() > 0) &&
-                        sPlayerbotAIConfig->toxicLinksRepliesChance)
-                    {
-                        if (urand(0, 50) > 0 || urand(1, 100) > sPlayerbotAIConfig->toxicLinksRepliesChance)
-                        {
-                            return;
-                        }
-                    }
-                    else if ((GetChatHelper()->ExtractAllItemIds(message).count(19019) &&
-                            sPlayerbotAIConfig->thunderfuryRepliesChance))
-                    {
-                        if (urand(0, 60) > 0 || urand(1, 100) > sPlayerbotAIConfig->thunderfuryRepliesChance)
-                        {
-                            return;
-                        }
-                    }
-                    else
-                    {
-                        if (isFromFreeBot && urand(0, 20))
-                            return;
-
-                        // if (msgtype == CHAT_MSG_GUILD && (!sPlayerbotAIConfig->guildRepliesRate || urand(1, 100) >=
-                        // sPlayerbotAIConfig->guildRepliesRate)) return;
-
-                        if (!isFromFreeBot)
-                        {
-                            if (!isMentioned && urand(0, 4))
-                                return;
-                        }
-                        else
-                        {
-                            if (urand(0, 20 + 10 * isMentioned))
-                                return;
-                        }
-                    }
-
-                    QueueChatResponse(
-                        std::move(ChatQueuedReply{msgtype, guid1.GetCounter(), guid2.GetCounter(), message, chanName,
-                                                  name, time(nullptr) + urand(inCombat ? 10 : 5, inCombat ? 25 : 15)}));
-                    GetAiObjectContext()->GetValue<time_t>("last said", "chat")->Set(time(0) + urand(5, 25));
-                    return;
                 }
             }
 
+            QueueChatResponse(std::move(ChatQueuedReply{msgtype, guid1.GetCounter(), guid2.GetCounter(), parsed,
+                                                        chanName, name,
+                                                        time(nullptr) + urand(inCombat ? 10 : 5, inCombat ? 25 : 15)}));
+            GetAiObjectContext()->GetValue<time_t>("last said", "chat")->Set(time(0) + urand(5, 25));
             return;
         }
-        case SMSG_MOVE_KNOCK_BACK:  // handle knockbacks
-        {
-            WorldPacket p(packet);
-            p.rpos(0);
-
-            ObjectGuid guid;
-            uint32 counter;
-            float vcos, vsin, horizontalSpeed, verticalSpeed = 0.f;
+    }
+}
 
-            p >> guid.ReadAsPacked() >> counter >> vcos >> vsin >> horizontalSpeed >> verticalSpeed;
-            if (horizontalSpeed <= 0.1f)
-            {
-                horizontalSpeed = 0.11f;
-            }
-            verticalSpeed = -verticalSpeed;
-            // high vertical may result in stuck as bot can not handle gravity
-            if (verticalSpeed > 35.0f)
-                break;
-            // stop casting
-            InterruptSpell();
+void PlayerbotAI::HandleBotKnockBack(WorldPacket const& packet, PacketHeader const& header)
+{
+    // packed guid and movement counter come first
+    std::size_t pos = header.payload + 4;
+    float vcos = packet.read<float>(pos);
+    float vsin = packet.read<float>(pos + 4);
+    float horizontalSpeed = packet.read<float>(pos + 8);
+    float verticalSpeed = packet.read<float>(pos + 12);
+    if (horizontalSpeed <= 0.1f)
+    {
+        horizontalSpeed = 0.11f;
+    }
+    verticalSpeed = -verticalSpeed;
+    // high vertical may result in stuck as bot can not handle gravity
+    if (verticalSpeed > 35.0f)
+        return;
+    // stop casting
+    InterruptSpell();
 
-            // stop movement
-            bot->StopMoving();
-            bot->GetMotionMaster()->Clear();
+    // stop movement
+    bot->StopMoving();
+    bot->GetMotionMaster()->Clear();
 
-            Unit* currentTarget = GetAiObjectContext()->GetValue<Unit*>("current target")->Get();
-            bot->GetMotionMaster()->MoveKnockbackFromForPlayer(bot->GetPositionX() - vcos, bot->GetPositionY() - vsin,
-                                                               horizontalSpeed, verticalSpeed);
-
-            // bot->AddUnitMovementFlag(MOVEMENTFLAG_FALLING);
-            // bot->AddUnitMovementFlag(MOVEMENTFLAG_FORWARD);
-            // bot->m_movementInfo.AddMovementFlag(MOVEMENTFLAG_PENDING_STOP);
-            // if (bot->m_movementInfo.HasMovementFlag(MOVEMENTFLAG_SPLINE_ELEVATION))
-            //     bot->m_movementInfo.RemoveMovementFlag(MOVEMENTFLAG_SPLINE_ELEVATION);
-            // bot->GetMotionMaster()->MoveIdle();
-            // Position dest = bot->GetPosition();
-            // float moveTimeHalf = verticalSpeed / Movement::gravity;
-            // float dist = 2 * moveTimeHalf * horizontalSpeed;
-            // float max_height = -Movement::computeFallElevation(moveTimeHalf, false, -verticalSpeed);
-
-            // Use a mmap raycast to get a valid destination.
-            // bot->GetMotionMaster()->MoveKnockbackFrom(fx, fy, horizontalSpeed, verticalSpeed);
-
-            // // set delay based on actual distance
-            // float newdis = sqrt(sServerFacade->GetDistance2d(bot, fx, fy));
-            // SetNextCheckDelay((uint32)((newdis / dis) * moveTimeHalf * 4 * IN_MILLISECONDS));
-
-            // // add moveflags
-
-            // // copy MovementInfo
-            // MovementInfo movementInfo = bot->m_movementInfo;
-
-            // // send ack
-            // WorldPacket ack(CMSG_MOVE_KNOCK_BACK_ACK);
-            // // movementInfo.jump.cosAngle = vcos;
-            // // movementInfo.jump.sinAngle = vsin;
-            // // movementInfo.jump.zspeed = -verticalSpeed;
-            // // movementInfo.jump.xyspeed = horizontalSpeed;
-            // ack << bot->GetGUID().WriteAsPacked();
-            // // bot->m_mover->BuildMovementPacket(&ack);
-            // ack << (uint32)0;
-            // bot->BuildMovementPacket(&ack);
-            // // ack << movementInfo.jump.sinAngle;
-            // // ack << movementInfo.jump.cosAngle;
-            // // ack << movementInfo.jump.xyspeed;
-            // // ack << movementInfo.jump.zspeed;
-            // bot->GetSession()->HandleMoveKnockBackAck(ack);
-
-            // // // set jump destination for MSG_LAND packet
-            // SetJumpDestination(Position(x, y, z, bot->GetOrientation()));
-
-            // bot->Heart();
-
-            // */
-            return;
-        }
-        default:
-            botOutgoingPacketHandlers.AddPacket(packet);
-    }
+    Unit* currentTarget = GetAiObjectContext()->GetValue<Unit*>("current target")->Get();
+    bot->GetMotionMaster()->MoveKnockbackFromForPlayer(bot->GetPositionX() - vcos, bot->GetPositionY() - vsin,
+                                                       horizontalSpeed, verticalSpeed);
+
+    // bot->AddUnitMovementFlag(MOVEMENTFLAG_FALLING);
+    // bot->AddUnitMovementFlag(MOVEMENTFLAG_FORWARD);
+    // bot->m_movementInfo.AddMovementFlag(MOVEMENTFLAG_PENDING_STOP);
+    // if (bot->m_movementInfo.HasMovementFlag(MOVEMENTFLAG_SPLINE_ELEVATION))
+    //     bot->m_movementInfo.RemoveMovementFlag(MOVEMENTFLAG_SPLINE_ELEVATION);
+    // bot->GetMotionMaster()->MoveIdle();
+    // Position dest = bot->GetPosition();
+    // float moveTimeHalf = verticalSpeed / Movement::gravity;
+    // float dist = 2 * moveTimeHalf * horizontalSpeed;
+    // float max_height = -Movement::computeFallElevation(moveTimeHalf, false, -verticalSpeed);
+
+    // Use a mmap raycast to get a valid destination.
+    // bot->GetMotionMaster()->MoveKnockbackFrom(fx, fy, horizontalSpeed, verticalSpeed);
+
+    // // set delay based on actual distance
+    // float newdis = sqrt(sServerFacade->GetDistance2d(bot, fx, fy));
+    // SetNextCheckDelay((uint32)((newdis / dis) * moveTimeHalf * 4 * IN_MILLISECONDS));
+
+    // // add moveflags
+
+    // // copy MovementInfo
+    // MovementInfo movementInfo = bot->m_movementInfo;
+
+    // // send ack
+    // WorldPacket ack(CMSG_MOVE_KNOCK_BACK_ACK);
+    // // movementInfo.jump.cosAngle = vcos;
+    // // movementInfo.jump.sinAngle = vsin;
+    // // movementInfo.jump.zspeed = -verticalSpeed;
+    // // movementInfo.jump.xyspeed = horizontalSpeed;
+    // ack << bot->GetGUID().WriteAsPacked();
+    // // bot->m_mover->BuildMovementPacket(&ack);
+    // ack << (uint32)0;
+    // bot->BuildMovementPacket(&ack);
+    // // ack << movementInfo.jump.sinAngle;
+    // // ack << movementInfo.jump.cosAngle;
+    // // ack << movementInfo.jump.xyspeed;
+    // // ack << movementInfo.jump.zspeed;
+    // bot->GetSession()->HandleMoveKnockBackAck(ack);
+
+    // // // set jump destination for MSG_LAND packet
+    // SetJumpDestination(Position(x, y, z, bot->GetOrientation()));
+
+    // bot->Heart();
+
+    // */
 }
 
 void PlayerbotAI::SpellInterrupted(uint32 spellid)
@@ -1301,12 +1391,12 @@ int32 PlayerbotAI::CalculateGlobalCooldown(uint32 spellid)
     return sPlayerbotAIConfig->reactDelay;
 }
 
-void PlayerbotAI::HandleMasterIncomingPacket(WorldPacket const& packet)
+void PlayerbotAI::HandleMasterIncomingPacket(SharedPacket& packet)
 {
     masterIncomingPacketHandlers.AddPacket(packet);
 }
 
-void PlayerbotAI::HandleMasterOutgoingPacket(WorldPacket const& packet)
+void PlayerbotAI::HandleMasterOutgoingPacket(SharedPacket& packet)
 {
     masterOutgoingPacketHandlers.AddPacket(packet);
 }
@@ -6,6 +6,8 @@
 #ifndef _PLAYERBOT_PLAYERbotAI_H
 #define _PLAYERBOT_PLAYERbotAI_H
 
+#include <bitset>
+#include <memory>
 #include <queue>
 #include <stack>
 
@@ -17,6 +19,7 @@
 #include "Item.h"
 #include "PlayerbotAIBase.h"
 #include "PlayerbotAIConfig.h"
+#include "PlayerbotChatMessage.h"
 #include "PlayerbotSecurity.h"
 #include "PlayerbotTextMgr.h"
 #include "SpellAuras.h"
@@ -354,16 +357,46 @@ enum WARRIOR_TABS
     WARRIOR_TAB_PROTECTION,
 };
 
+// Fields bots filter a packet on, read in place so packets nobody queues are never copied
+struct PacketHeader
+{
+    PacketHeader(WorldPacket const& packet);
+
+    uint16 opcode;
+    // caster, sender or moved unit the packet is about, empty for other opcodes
+    ObjectGuid guid;
+    // read position of the first field after the header
+    std::size_t payload;
+};
+
+// A packet fanned out to several bots, copied once by the first bot that queues it
+class SharedPacket
+{
+public:
+    SharedPacket(WorldPacket const& packet) : packet(packet) {}
+
+    uint16 GetOpcode() const { return packet.GetOpcode(); }
+    bool empty() const { return packet.empty(); }
+    std::shared_ptr<WorldPacket const> const& Get();
+
+private:
+    WorldPacket const& packet;
+    std::shared_ptr<WorldPacket const> shared;
+};
+
 class PacketHandlingHelper
 {
 public:
     void AddHandler(uint16 opcode, std::string const handler);
     void Handle(ExternalEventHelper& helper);
     void AddPacket(WorldPacket const& packet);
+    void AddPacket(SharedPacket& packet);
+    bool HasPackets() const { return !queue.empty(); }
+    void AddOpcodes(std::bitset<NUM_MSG_TYPES>& opcodes) const;
 
 private:
     std::map<uint16, std::string> handlers;
-    std::stack<WorldPacket> queue;
+    std::stack<std::shared_ptr<WorldPacket const>> queue;
 };
 
 class ChatCommandHolder
@@ -400,13 +433,16 @@ public:
 
     void UpdateAI(uint32 elapsed, bool minimal = false) override;
     void UpdateAIInternal(uint32 elapsed, bool minimal = false) override;
+    void PrepareAI(uint32 elapsed);
+    void ClearPreparedTriggers();
 
     std::string const HandleRemoteCommand(std::string const command);
     void HandleCommand(uint32 type, std::string const text, Player* fromPlayer);
+    void HandleCommand(uint32 type, PlayerbotChatMessage const& message, Player* fromPlayer);
     void QueueChatResponse(const ChatQueuedReply reply);
     void HandleBotOutgoingPacket(WorldPacket const& packet);
-    void HandleMasterIncomingPacket(WorldPacket const& packet);
-    void HandleMasterOutgoingPacket(WorldPacket const& packet);
+    void HandleMasterIncomingPacket(SharedPacket& packet);
+    void HandleMasterOutgoingPacket(SharedPacket& packet);
     void HandleTeleportAck();
     void ChangeEngine(BotState type);
     void DoNextAction(bool minimal = false);
@@ -419,6 +455,7 @@ public:
     bool ContainsStrategy(StrategyType type);
     bool HasStrategy(std::string const name, BotState type);
     BotState GetState() { return currentState; };
+    Engine* GetCurrentEngine() { return currentEngine; }
     void ResetStrategies(bool load = false);
     void ReInitCurrentEngine();
     void Reset(bool full = false);
@@ -602,8 +639,17 @@ private:
     bool IsTellAllowed(PlayerbotSecurityLevel securityLevel = PLAYERBOT_SECURITY_ALLOW_ALL);
 
     void HandleCommands();
+    void HandleChatCommand(uint32 type, PlayerbotChatCommand const& command, Player* fromPlayer);
     void HandleCommand(uint32 type, const std::string& text, Player& fromPlayer, const uint32 lang = LANG_UNIVERSAL);
 
+    typedef void (PlayerbotAI::*BotPacketReader)(WorldPacket const& packet, PacketHeader const& header);
+    static std::map<uint16, BotPacketReader> const botPacketReaders;
+    void HandleBotSpellFailure(WorldPacket const& packet, PacketHeader const& header);
+    void HandleBotSpellDelayed(WorldPacket const& packet, PacketHeader const& header);
+    void HandleBotEmote(WorldPacket const& packet, PacketHeader const& header);
+    void HandleBotChat(WorldPacket const& packet, PacketHeader const& header);
+    void HandleBotKnockBack(WorldPacket const& packet, PacketHeader const& header);
+
 protected:
     Player* bot;
     Player* master;
@@ -615,6 +661,8 @@ protected:
     ChatHelper chatHelper;
     std::list<ChatCommandHolder> chatCommands;
     std::list<ChatQueuedReply> chatReplies;
+    uint32 performanceMapId = MAPID_INVALID;
+    uint32 performanceId = 0;
     PacketHandlingHelper botOutgoingPacketHandlers;
     PacketHandlingHelper masterIncomingPacketHandlers;
     PacketHandlingHelper masterOutgoingPacketHandlers;
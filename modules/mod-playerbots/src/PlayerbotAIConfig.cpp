@@ -8,8 +8,10 @@
 #include <iostream>
 
 #include "Config.h"
+#include "PlayerbotChatMessage.h"
 #include "PlayerbotDungeonSuggestionMgr.h"
 #include "PlayerbotFactory.h"
+#include "PlayerbotStartupGraph.h"
 #include "Playerbots.h"
 #include "RandomItemMgr.h"
 #include "RandomPlayerbotFactory.h"
@@ -125,6 +127,11 @@ bool PlayerbotAIConfig::Initialize()
     randomBotRpgChance = sConfigMgr->GetOption<float>("AiPlayerbot.RandomBotRpgChance", 0.20f);
 
     iterationsPerTick = sConfigMgr->GetOption<int32>("AiPlayerbot.IterationsPerTick", 100);
+    parallelBotUpdateThreads = sConfigMgr->GetOption<int32>("AiPlayerbot.ParallelBotUpdateThreads", 0);
+    parallelBotUpdateMinBots = sConfigMgr->GetOption<int32>("AiPlayerbot.ParallelBotUpdateMinBots", 100);
+    startupThreads = sConfigMgr->GetOption<int32>("AiPlayerbot.StartupThreads", 4);
+    cacheSnapshotFile = sConfigMgr->GetOption<std::string>("AiPlayerbot.CacheSnapshotFile", "playerbots_cache.bin");
+    losCacheTime = sConfigMgr->GetOption<int32>("AiPlayerbot.LosCacheTime", 500);
 
     allowGuildBots = sConfigMgr->GetOption<bool>("AiPlayerbot.AllowGuildBots", true);
     randomBotGuildNearby = sConfigMgr->GetOption<bool>("AiPlayerbot.RandomBotGuildNearby", false);
@@ -176,8 +183,11 @@ bool PlayerbotAIConfig::Initialize()
     maxRandomBotTeleportInterval = sConfigMgr->GetOption<int32>("AiPlayerbot.MaxRandomBotTeleportInterval", 5 * HOUR);
     randomBotInWorldWithRotationDisabled =
         sConfigMgr->GetOption<int32>("AiPlayerbot.RandomBotInWorldWithRotationDisabled", 1 * YEAR);
+    randomBotEventFlushInterval = sConfigMgr->GetOption<int32>("AiPlayerbot.RandomBotEventFlushInterval", 30);
     randomBotTeleportDistance = sConfigMgr->GetOption<int32>("AiPlayerbot.RandomBotTeleportDistance", 100);
     randomBotsPerInterval = sConfigMgr->GetOption<int32>("AiPlayerbot.RandomBotsPerInterval", 60);
+    botLoginTargetUpdateTime = sConfigMgr->GetOption<int32>("AiPlayerbot.BotLoginTargetUpdateTime", 100);
+    botLoginMaxTimeBudget = sConfigMgr->GetOption<int32>("AiPlayerbot.BotLoginMaxTimeBudget", 50);
     minRandomBotsPriceChangeInterval =
         sConfigMgr->GetOption<int32>("AiPlayerbot.MinRandomBotsPriceChangeInterval", 2 * HOUR);
     maxRandomBotsPriceChangeInterval =
@@ -309,6 +319,7 @@ bool PlayerbotAIConfig::Initialize()
 
     commandPrefix = sConfigMgr->GetOption<std::string>("AiPlayerbot.CommandPrefix", "");
     commandSeparator = sConfigMgr->GetOption<std::string>("AiPlayerbot.CommandSeparator", "\\\\");
+    sPlayerbotChatCache->Clear();
 
     commandServerPort = sConfigMgr->GetOption<int32>("AiPlayerbot.CommandServerPort", 8888);
     perfMonEnabled = sConfigMgr->GetOption<bool>("AiPlayerbot.PerfMonEnabled", false);
@@ -517,32 +528,51 @@ bool PlayerbotAIConfig::Initialize()
 
     selfBotLevel = sConfigMgr->GetOption<int32>("AiPlayerbot.SelfBotLevel", 1);
 
-    RandomPlayerbotFactory::CreateRandomBots();
-    if (World::IsStopped())
-    {
-        return true;
-    }
+    PlayerbotStartupGraph startup;
+    startup.Add("random bots", []() { RandomPlayerbotFactory::CreateRandomBots(); });
+    // the manager prepares its teleport cache when it is first used
+    startup.Add("random bot manager", []() { sRandomPlayerbotMgr; });
+    startup.Add("random bot events", []() { sRandomPlayerbotMgr->LoadEvents(); },
+                {"random bots", "random bot manager"});
+
     if (sPlayerbotAIConfig->addClassCommand)
-        sRandomPlayerbotMgr->PrepareAddclassCache();
+        startup.Add("addclass cache", []() { sRandomPlayerbotMgr->PrepareAddclassCache(); },
+                    {"random bots", "random bot manager"});
 
-    sRandomItemMgr->Init();
-    sRandomItemMgr->InitAfterAhBot();
-    sPlayerbotTextMgr->LoadBotTexts();
-    sPlayerbotTextMgr->LoadBotTextChance();
-    PlayerbotFactory::Init();
+    startup.Add("item caches", []() { sRandomItemMgr->Init(); });
+    startup.Add("random item cache", []() { sRandomItemMgr->InitAfterAhBot(); }, {"item caches"});
+    startup.Add("bot texts",
+                []()
+                {
+                    sPlayerbotTextMgr->LoadBotTexts();
+                    sPlayerbotTextMgr->LoadBotTextChance();
+                });
+    startup.Add("factory", []() { PlayerbotFactory::Init(); }, {"item caches"});
 
     if (!sPlayerbotAIConfig->autoDoQuests)
     {
-        LOG_INFO("server.loading", "Loading Quest Detail Data...");
-        sTravelMgr->LoadQuestTravelTable();
+        startup.Add("quest travel table",
+                    []()
+                    {
+                        LOG_INFO("server.loading", "Loading Quest Detail Data...");
+                        sTravelMgr->LoadQuestTravelTable();
+                    });
     }
 
     if (sPlayerbotAIConfig->randomBotJoinBG)
-        sRandomPlayerbotMgr->LoadBattleMastersCache();
+        startup.Add("battle masters", []() { sRandomPlayerbotMgr->LoadBattleMastersCache(); },
+                    {"random bot manager"});
 
     if (sPlayerbotAIConfig->randomBotSuggestDungeons)
     {
-        sPlayerbotDungeonSuggestionMgr->LoadDungeonSuggestions();
+        startup.Add("dungeon suggestions", []() { sPlayerbotDungeonSuggestionMgr->LoadDungeonSuggestions(); });
+    }
+
+    startup.Run(startupThreads);
+
+    if (World::IsStopped())
+    {
+        return true;
     }
 
     LOG_INFO("server.loading", "---------------------------------------");
@@ -95,8 +95,10 @@ public:
     uint32 minRandomBotReviveTime, maxRandomBotReviveTime;
     uint32 minRandomBotTeleportInterval, maxRandomBotTeleportInterval;
     uint32 randomBotInWorldWithRotationDisabled;
+    uint32 randomBotEventFlushInterval;
     uint32 minRandomBotPvpTime, maxRandomBotPvpTime;
     uint32 randomBotsPerInterval;
+    uint32 botLoginTargetUpdateTime, botLoginMaxTimeBudget;
     uint32 minRandomBotsPriceChangeInterval, maxRandomBotsPriceChangeInterval;
     bool randomBotJoinLfg;
 
@@ -234,6 +236,10 @@ public:
     uint32 guildTaskKillTaskDistance;
 
     uint32 iterationsPerTick;
+    uint32 parallelBotUpdateThreads, parallelBotUpdateMinBots;
+    uint32 startupThreads;
+    std::string cacheSnapshotFile;
+    uint32 losCacheTime;
 
     std::mutex m_logMtx;
     std::vector<std::string> allowedLogFiles;
@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, released under GNU GPL v2 license, you may redistribute it
+ * and/or modify it under version 2 of the License, or (at your option), any later version.
+ */
+
+#include "PlayerbotChatMessage.h"
+
+#include <algorithm>
+#include <sstream>
+#include <unordered_set>
+
+#include "ChatHelper.h"
+#include "PerformanceMonitor.h"
+#include "Playerbots.h"
+
+// senders are forgotten all at once when this many spoke since the last time
+#define PLAYERBOT_CHAT_CACHE_SIZE 1024
+// replies look up to this many words into a line
+#define PLAYERBOT_CHAT_MIN_WORDS 14
+
+std::string& trim(std::string& s);
+
+static std::map<std::string, ChatMsg> const replyChatTags = {{"#w ", CHAT_MSG_WHISPER},
+                                                             {"#p ", CHAT_MSG_PARTY},
+                                                             {"#r ", CHAT_MSG_RAID},
+                                                             {"#a ", CHAT_MSG_ADDON},
+                                                             {"#g ", CHAT_MSG_GUILD}};
+
+static const std::unordered_set<std::string> noReplyMsgs = {
+    "join",
+    "leave",
+    "follow",
+    "attack",
+    "pull",
+    "flee",
+    "reset",
+    "reset ai",
+    "all ?",
+    "talents",
+    "talents list",
+    "talents auto",
+    "talk",
+    "stay",
+    "stats",
+    "who",
+    "items",
+    "leave",
+    "join",
+    "repair",
+    "summon",
+    "nc ?",
+    "co ?",
+    "de ?",
+    "dead ?",
+    "follow",
+    "los",
+    "guard",
+    "do accept invitation",
+    "stats",
+    "react ?",
+    "reset strats",
+    "home",
+};
+static const std::unordered_set<std::string> noReplyMsgParts = {
+    "+", "-", "@", "follow target", "focus heal", "cast ", "accept [", "e [", "destroy [", "go zone"};
+static const std::unordered_set<std::string> noReplyMsgStarts = {"e ", "accept ", "cast ", "destroy "};
+
+PlayerbotChatMessage::PlayerbotChatMessage(std::string const& text) : text(text)
+{
+    if (text.find(sPlayerbotAIConfig->commandSeparator) != std::string::npos)
+    {
+        std::vector<std::string> parts;
+        split(parts, text, sPlayerbotAIConfig->commandSeparator.c_str());
+        for (std::string const& part : parts)
+            ParseCommand(part);
+    }
+    else
+        ParseCommand(text);
+
+    std::stringstream stream(text);
+    std::string word;
+    while (std::getline(stream, word, ' '))
+        words.push_back(word);
+
+    if (words.size() < PLAYERBOT_CHAT_MIN_WORDS)
+        words.resize(PLAYERBOT_CHAT_MIN_WORDS);
+
+    itemIds = ChatHelper::ExtractAllItemIds(text);
+    questIds = ChatHelper::ExtractAllQuestIds(text);
+
+    replyBlocked = noReplyMsgs.find(text) != noReplyMsgs.end() ||
+                   std::any_of(noReplyMsgParts.begin(), noReplyMsgParts.end(),
+                               [&text](std::string const& part) { return text.find(part) != std::string::npos; }) ||
+                   std::any_of(noReplyMsgStarts.begin(), noReplyMsgStarts.end(),
+                               [&text](std::string const& start) { return text.find(start) == 0; });
+
+    toxicLinks = text.starts_with(sPlayerbotAIConfig->toxicLinksPrefix) && (!itemIds.empty() || !questIds.empty());
+}
+
+void PlayerbotChatMessage::ParseCommand(std::string command)
+{
+    if (!sPlayerbotAIConfig->commandPrefix.empty())
+    {
+        if (command.find(sPlayerbotAIConfig->commandPrefix) != 0)
+            return;
+
+        command = command.substr(sPlayerbotAIConfig->commandPrefix.size());
+    }
+
+    ChatMsg replyChat = CHAT_MSG_WHISPER;
+    bool hasReplyChat = false;
+    for (auto const& [tag, chat] : replyChatTags)
+    {
+        if (command.find(tag) == 0)
+        {
+            command = command.substr(tag.size());
+            replyChat = chat;
+            hasReplyChat = true;
+            break;
+        }
+    }
+
+    trim(command);
+    if (!command.empty())
+        commands.push_back({command, replyChat, hasReplyChat});
+}
+
+PlayerbotChatCache::PlayerbotChatCache() : counter(sPerformanceMonitor->GetCounter("PlayerbotChatCache")) {}
+
+std::shared_ptr<PlayerbotChatMessage const> PlayerbotChatCache::Get(ObjectGuid sender, std::string const& text)
+{
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        auto itr = messages.find(sender);
+        if (itr != messages.end() && itr->second->GetText() == text)
+        {
+            if (sPlayerbotAIConfig->perfMonEnabled)
+                ++counter->hits;
+
+            return itr->second;
+        }
+    }
+
+    if (sPlayerbotAIConfig->perfMonEnabled)
+        ++counter->misses;
+
+    std::shared_ptr<PlayerbotChatMessage const> message = std::make_shared<PlayerbotChatMessage const>(text);
+
+    std::lock_guard<std::mutex> guard(lock);
+    if (messages.size() >= PLAYERBOT_CHAT_CACHE_SIZE)
+        messages.clear();
+
+    messages[sender] = message;
+    return message;
+}
+
+void PlayerbotChatCache::Clear()
+{
+    std::lock_guard<std::mutex> guard(lock);
+    messages.clear();
+}
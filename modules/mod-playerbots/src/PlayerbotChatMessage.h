@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, released under GNU GPL v2 license, you may redistribute it
+ * and/or modify it under version 2 of the License, or (at your option), any later version.
+ */
+
+#ifndef _PLAYERBOT_PLAYERBOTCHATMESSAGE_H
+#define _PLAYERBOT_PLAYERBOTCHATMESSAGE_H
+
+#include <memory>
+#include <mutex>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+#include "Common.h"
+#include "ObjectGuid.h"
+#include "SharedDefines.h"
+
+struct PerformanceCounter;
+
+// One command of a chat line with the prefix and reply chat tag every bot would strip already removed
+struct PlayerbotChatCommand
+{
+    std::string text;
+    // a "#p " like tag in front of the command makes the bot answer in that chat for a moment
+    ChatMsg replyChat;
+    bool hasReplyChat;
+};
+
+// A chat line parsed once for all bots hearing it. Bots share it, so it never changes after parsing.
+class PlayerbotChatMessage
+{
+public:
+    PlayerbotChatMessage(std::string const& text);
+
+    std::string const& GetText() const { return text; }
+    std::vector<PlayerbotChatCommand> const& GetCommands() const { return commands; }
+    // words split on spaces, padded with empty ones so replies can look a few words ahead
+    std::vector<std::string> const& GetWords() const { return words; }
+    std::set<uint32> const& GetItemIds() const { return itemIds; }
+    std::set<uint32> const& GetQuestIds() const { return questIds; }
+    // bot commands and strategy changes are not chatter to answer
+    bool IsReplyBlocked() const { return replyBlocked; }
+    bool IsToxicLinks() const { return toxicLinks; }
+
+private:
+    void ParseCommand(std::string command);
+
+    std::string const text;
+    std::vector<PlayerbotChatCommand> commands;
+    std::vector<std::string> words;
+    std::set<uint32> itemIds;
+    std::set<uint32> questIds;
+    bool replyBlocked;
+    bool toxicLinks;
+};
+
+// Last line of every sender, the first bot hearing a line parses it for the others
+class PlayerbotChatCache
+{
+public:
+    PlayerbotChatCache();
+    virtual ~PlayerbotChatCache() {}
+    static PlayerbotChatCache* instance()
+    {
+        static PlayerbotChatCache instance;
+        return &instance;
+    }
+
+    std::shared_ptr<PlayerbotChatMessage const> Get(ObjectGuid sender, std::string const& text);
+    // parsed lines depend on the command prefix and separator, they are dropped when the config is loaded
+    void Clear();
+
+private:
+    std::mutex lock;
+    std::unordered_map<ObjectGuid, std::shared_ptr<PlayerbotChatMessage const>> messages;
+    PerformanceCounter* counter;
+};
+
+#define sPlayerbotChatCache PlayerbotChatCache::instance()
+
+#endif
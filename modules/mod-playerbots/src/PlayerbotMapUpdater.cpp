@@ -0,0 +1,224 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, released under GNU GPL v2 license, you may redistribute it
+ * and/or modify it under version 2 of the License, or (at your option), any later version.
+ */
+
+#include "PlayerbotMapUpdater.h"
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+
+#include "DatabaseEnv.h"
+#include "Map.h"
+#include "Playerbots.h"
+
+// ungrouped bots are prepared in chunks of this size, grouped bots always share the chunk of their group
+#define PREPARE_BOTS_PARTITION_SIZE 16
+
+typedef std::vector<std::pair<PlayerbotAI*, uint32>> PreparePartition;
+
+struct DeferredBotUpdate
+{
+    ObjectGuid guid;
+    uint32 diff;
+};
+
+// a map is updated entirely by one thread, so the bots collected by its player loop never leave that thread
+static thread_local std::vector<DeferredBotUpdate> deferredUpdates;
+static thread_local Map* deferredMap = nullptr;
+
+class PrepareBotsBatch
+{
+public:
+    PrepareBotsBatch(std::vector<PreparePartition>& partitions) : next(0), done(0) { this->partitions.swap(partitions); }
+
+    void Run()
+    {
+        uint32 index;
+        while ((index = next++) < partitions.size())
+        {
+            for (std::pair<PlayerbotAI*, uint32> const& bot : partitions[index])
+                bot.first->PrepareAI(bot.second);
+
+            if (++done == partitions.size())
+            {
+                std::lock_guard<std::mutex> guard(lock);
+                condition.notify_all();
+            }
+        }
+    }
+
+    void Wait()
+    {
+        std::unique_lock<std::mutex> guard(lock);
+        while (done < partitions.size())
+            condition.wait(guard);
+    }
+
+private:
+    std::vector<PreparePartition> partitions;
+    std::atomic<uint32> next;
+    std::atomic<uint32> done;
+    std::mutex lock;
+    std::condition_variable condition;
+};
+
+class PrepareBotsRequest
+{
+public:
+    PrepareBotsRequest(std::shared_ptr<PrepareBotsBatch> batch) : batch(batch) {}
+
+    void call() { batch->Run(); }
+
+private:
+    std::shared_ptr<PrepareBotsBatch> batch;
+};
+
+void PlayerbotMapUpdater::Activate(uint32 numThreads)
+{
+    if (IsActive() || !numThreads)
+        return;
+
+    _workerThreads.reserve(numThreads);
+    for (uint32 i = 0; i < numThreads; ++i)
+        _workerThreads.push_back(std::thread(&PlayerbotMapUpdater::WorkerThread, this));
+
+    LOG_INFO("server.loading", "Playerbots: {} threads evaluate bot triggers in parallel", numThreads);
+}
+
+void PlayerbotMapUpdater::Deactivate()
+{
+    _cancelationToken = true;
+    _queue.Cancel();
+
+    for (std::thread& thread : _workerThreads)
+    {
+        if (thread.joinable())
+            thread.join();
+    }
+
+    _workerThreads.clear();
+}
+
+bool PlayerbotMapUpdater::Defer(Player* bot, uint32 diff)
+{
+    if (!IsActive())
+        return false;
+
+    Map* map = bot->FindMap();
+    if (!map)
+        return false;
+
+    if (deferredMap != map)
+    {
+        deferredUpdates.clear();
+        deferredMap = map;
+    }
+
+    deferredUpdates.push_back({bot->GetGUID(), diff});
+    return true;
+}
+
+void PlayerbotMapUpdater::Update(Map* map)
+{
+    if (deferredMap != map || deferredUpdates.empty())
+        return;
+
+    std::vector<std::pair<PlayerbotAI*, uint32>> bots;
+    bots.reserve(deferredUpdates.size());
+    for (DeferredBotUpdate const& update : deferredUpdates)
+    {
+        Player* bot = ObjectAccessor::GetPlayer(map, update.guid);
+        if (!bot)
+            continue;
+
+        if (PlayerbotAI* botAI = GET_PLAYERBOT_AI(bot))
+            bots.push_back(std::make_pair(botAI, update.diff));
+    }
+
+    std::vector<DeferredBotUpdate> updates;
+    updates.swap(deferredUpdates);
+    deferredMap = nullptr;
+
+    bool prepared = !bots.empty() && bots.size() >= sPlayerbotAIConfig->parallelBotUpdateMinBots;
+    if (prepared)
+        PrepareBots(bots);
+
+    // actions touch the world, so they are applied in map order on this thread
+    for (std::pair<PlayerbotAI*, uint32> const& bot : bots)
+        bot.first->UpdateAI(bot.second);
+
+    if (!prepared)
+        return;
+
+    // bots that did not reach their engine keep nothing for the serial path, logged out bots are gone already
+    for (DeferredBotUpdate const& update : updates)
+    {
+        if (Player* bot = ObjectAccessor::GetPlayer(map, update.guid))
+            if (PlayerbotAI* botAI = GET_PLAYERBOT_AI(bot))
+                botAI->ClearPreparedTriggers();
+    }
+}
+
+void PlayerbotMapUpdater::PrepareBots(std::vector<std::pair<PlayerbotAI*, uint32>> const& bots)
+{
+    // members of one group read each other's values, keep them on the same thread
+    std::vector<PreparePartition> partitions;
+    std::unordered_map<ObjectGuid, uint32> groupPartitions;
+    uint32 looseIndex = 0;
+    bool hasLoose = false;
+    for (std::pair<PlayerbotAI*, uint32> const& bot : bots)
+    {
+        if (Group* group = bot.first->GetBot()->GetGroup())
+        {
+            auto itr = groupPartitions.emplace(group->GetGUID(), partitions.size());
+            if (itr.second)
+                partitions.emplace_back();
+
+            partitions[itr.first->second].push_back(bot);
+            continue;
+        }
+
+        if (!hasLoose || partitions[looseIndex].size() >= PREPARE_BOTS_PARTITION_SIZE)
+        {
+            looseIndex = partitions.size();
+            hasLoose = true;
+            partitions.emplace_back();
+        }
+
+        partitions[looseIndex].push_back(bot);
+    }
+
+    uint32 helpers = std::min<uint32>(_workerThreads.size(), partitions.size() - 1);
+    std::shared_ptr<PrepareBotsBatch> batch = std::make_shared<PrepareBotsBatch>(partitions);
+    for (uint32 i = 0; i < helpers; ++i)
+        _queue.Push(new PrepareBotsRequest(batch));
+
+    // the map thread works on its own batch instead of idling until the helpers are done
+    batch->Run();
+    batch->Wait();
+}
+
+void PlayerbotMapUpdater::WorkerThread()
+{
+    CharacterDatabase.WarnAboutSyncQueries(true);
+    WorldDatabase.WarnAboutSyncQueries(true);
+    PlayerbotsDatabase.WarnAboutSyncQueries(true);
+
+    while (true)
+    {
+        PrepareBotsRequest* request = nullptr;
+
+        _queue.WaitAndPop(request);
+        if (_cancelationToken)
+            return;
+
+        if (!request)
+            continue;
+
+        request->call();
+
+        delete request;
+    }
+}
@@ -0,0 +1,52 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, released under GNU GPL v2 license, you may redistribute it
+ * and/or modify it under version 2 of the License, or (at your option), any later version.
+ */
+
+#ifndef _PLAYERBOT_PLAYERBOTMAPUPDATER_H
+#define _PLAYERBOT_PLAYERBOTMAPUPDATER_H
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "Common.h"
+#include "PCQueue.h"
+
+class Map;
+class Player;
+class PlayerbotAI;
+class PrepareBotsRequest;
+
+// Runs the bot AI of one map in two phases: triggers of all due bots are evaluated on a worker pool,
+// then the engines execute their actions one bot after another on the map thread.
+class PlayerbotMapUpdater
+{
+public:
+    PlayerbotMapUpdater() : _cancelationToken(false) {}
+    virtual ~PlayerbotMapUpdater() {}
+    static PlayerbotMapUpdater* instance()
+    {
+        static PlayerbotMapUpdater instance;
+        return &instance;
+    }
+
+    void Activate(uint32 numThreads);
+    void Deactivate();
+    bool IsActive() const { return !_workerThreads.empty(); }
+
+    bool Defer(Player* bot, uint32 diff);
+    void Update(Map* map);
+
+private:
+    void PrepareBots(std::vector<std::pair<PlayerbotAI*, uint32>> const& bots);
+    void WorkerThread();
+
+    ProducerConsumerQueue<PrepareBotsRequest*> _queue;
+    std::vector<std::thread> _workerThreads;
+    std::atomic<bool> _cancelationToken;
+};
+
+#define sPlayerbotMapUpdater PlayerbotMapUpdater::instance()
+
+#endif
@@ -27,6 +27,7 @@
 #include "Playerbots.h"
 #include "RandomPlayerbotMgr.h"
 #include "SharedDefines.h"
+#include "Timer.h"
 #include "WorldSession.h"
 #include "ChannelMgr.h"
 #include "BroadcastHelper.h"
@@ -72,17 +73,36 @@ void PlayerbotHolder::AddPlayerBot(ObjectGuid playerGuid, uint32 masterAccountId
 
     botLoading.insert(playerGuid);
     
+    // the characters load on the database workers, adding them to the world is spread over the following ticks
     if (WorldSession* masterSession = sWorld->FindSession(masterAccountId))
     {
         masterSession->AddQueryHolderCallback(CharacterDatabase.DelayQueryHolder(holder))
-            .AfterComplete([this](SQLQueryHolderBase const& holder)
-                           { HandlePlayerBotLoginCallback(static_cast<PlayerbotLoginQueryHolder const&>(holder)); });
+            .AfterComplete([this, holder](SQLQueryHolderBase const&) { loginQueue.push_back(holder); });
     }
     else
     {
         sWorld->AddQueryHolderCallback(CharacterDatabase.DelayQueryHolder(holder))
-            .AfterComplete([this](SQLQueryHolderBase const& holder)
-                           { HandlePlayerBotLoginCallback(static_cast<PlayerbotLoginQueryHolder const&>(holder)); });
+            .AfterComplete([this, holder](SQLQueryHolderBase const&) { loginQueue.push_back(holder); });
+    }
+}
+
+void PlayerbotHolder::ProcessLoginQueue()
+{
+    if (loginQueue.empty())
+        return;
+
+    uint32 budget = GetLoginTimeBudget();
+    uint32 startTime = getMSTime();
+
+    // at least one bot per tick so a slow world still fills up
+    while (!loginQueue.empty())
+    {
+        std::shared_ptr<PlayerbotLoginQueryHolder> holder = loginQueue.front();
+        loginQueue.pop_front();
+        HandlePlayerBotLoginCallback(*holder);
+
+        if (budget && GetMSTimeDiffToNow(startTime) >= budget)
+            break;
     }
 }
 
@@ -183,6 +203,8 @@ void PlayerbotHolder::HandlePlayerBotLoginCallback(PlayerbotLoginQueryHolder con
 
 void PlayerbotHolder::UpdateSessions()
 {
+    ProcessLoginQueue();
+
     for (PlayerBotMap::const_iterator itr = GetPlayerBotsBegin(); itr != GetPlayerBotsEnd(); ++itr)
     {
         Player* const bot = itr->second;
@@ -1389,6 +1411,9 @@ void PlayerbotMgr::HandleCommand(uint32 type, std::string const text)
 
 void PlayerbotMgr::HandleMasterIncomingPacket(WorldPacket const& packet)
 {
+    // every bot of the master queues the same copy
+    SharedPacket shared(packet);
+
     for (PlayerBotMap::const_iterator it = GetPlayerBotsBegin(); it != GetPlayerBotsEnd(); ++it)
     {
         Player* const bot = it->second;
@@ -1396,7 +1421,7 @@ void PlayerbotMgr::HandleMasterIncomingPacket(WorldPacket const& packet)
             continue;
         PlayerbotAI* botAI = GET_PLAYERBOT_AI(bot);
         if (botAI)
-            botAI->HandleMasterIncomingPacket(packet);
+            botAI->HandleMasterIncomingPacket(shared);
     }
 
     for (PlayerBotMap::const_iterator it = sRandomPlayerbotMgr->GetPlayerBotsBegin();
@@ -1405,7 +1430,7 @@ void PlayerbotMgr::HandleMasterIncomingPacket(WorldPacket const& packet)
         Player* const bot = it->second;
         PlayerbotAI* botAI = GET_PLAYERBOT_AI(bot);
         if (botAI && botAI->GetMaster() == GetMaster())
-            botAI->HandleMasterIncomingPacket(packet);
+            botAI->HandleMasterIncomingPacket(shared);
     }
 
     switch (packet.GetOpcode())
@@ -1427,12 +1452,15 @@ void PlayerbotMgr::HandleMasterIncomingPacket(WorldPacket const& packet)
 
 void PlayerbotMgr::HandleMasterOutgoingPacket(WorldPacket const& packet)
 {
+    // every bot of the master queues the same copy
+    SharedPacket shared(packet);
+
     for (PlayerBotMap::const_iterator it = GetPlayerBotsBegin(); it != GetPlayerBotsEnd(); ++it)
     {
         Player* const bot = it->second;
         PlayerbotAI* botAI = GET_PLAYERBOT_AI(bot);
         if (botAI)
-            botAI->HandleMasterOutgoingPacket(packet);
+            botAI->HandleMasterOutgoingPacket(shared);
     }
 
     for (PlayerBotMap::const_iterator it = sRandomPlayerbotMgr->GetPlayerBotsBegin();
@@ -1441,7 +1469,7 @@ void PlayerbotMgr::HandleMasterOutgoingPacket(WorldPacket const& packet)
         Player* const bot = it->second;
         PlayerbotAI* botAI = GET_PLAYERBOT_AI(bot);
         if (botAI && botAI->GetMaster() == GetMaster())
-            botAI->HandleMasterOutgoingPacket(packet);
+            botAI->HandleMasterOutgoingPacket(shared);
     }
 }
 
@@ -6,6 +6,9 @@
 #ifndef _PLAYERBOT_PLAYERBOTMGR_H
 #define _PLAYERBOT_PLAYERBOTMGR_H
 
+#include <deque>
+#include <memory>
+
 #include "Common.h"
 #include "ObjectGuid.h"
 #include "Player.h"
@@ -40,6 +43,8 @@ public:
     void UpdateAIInternal([[maybe_unused]] uint32 elapsed, [[maybe_unused]] bool minimal = false) override{};
     void UpdateSessions();
     void HandleBotPackets(WorldSession* session);
+    // adds loaded bots to the world until the login time budget of this tick is spent
+    void ProcessLoginQueue();
 
     void LogoutAllBots();
     void OnBotLogin(Player* const bot);
@@ -56,9 +61,13 @@ public:
 
 protected:
     virtual void OnBotLoginInternal(Player* const bot) = 0;
+    // milliseconds per tick to spend adding loaded bots to the world, 0 adds all of them at once
+    virtual uint32 GetLoginTimeBudget() { return 0; }
 
     PlayerBotMap playerBots;
     std::unordered_set<ObjectGuid> botLoading;
+    // bots whose characters are loaded from the database and wait to be added to the world
+    std::deque<std::shared_ptr<PlayerbotLoginQueryHolder>> loginQueue;
 };
 
 class PlayerbotMgr : public PlayerbotHolder
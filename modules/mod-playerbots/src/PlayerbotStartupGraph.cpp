@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, released under GNU GPL v2 license, you may redistribute it
+ * and/or modify it under version 2 of the License, or (at your option), any later version.
+ */
+
+#include "PlayerbotStartupGraph.h"
+
+#include <thread>
+
+#include "Errors.h"
+#include "Log.h"
+#include "Timer.h"
+
+void PlayerbotStartupGraph::Add(std::string const name, std::function<void()> loader,
+                                std::vector<std::string> const dependencies)
+{
+    PlayerbotStartupStage stage;
+    stage.name = name;
+    stage.loader = std::move(loader);
+    stage.dependencies = dependencies;
+    stages.push_back(std::move(stage));
+}
+
+void PlayerbotStartupGraph::Run(uint32 threads)
+{
+    for (uint32 i = 0; i < stages.size(); ++i)
+    {
+        for (std::string const& dependency : stages[i].dependencies)
+        {
+            uint32 j = 0;
+            while (j < i && stages[j].name != dependency)
+                ++j;
+
+            // stages are added after what they need, which also rules out cycles
+            ASSERT(j < i, "Playerbot startup stage {} needs {} added before it", stages[i].name, dependency);
+
+            stages[j].dependents.push_back(i);
+            ++stages[i].waitingFor;
+        }
+
+        if (!stages[i].waitingFor)
+            ready.push_back(i);
+    }
+
+    startTime = getMSTime();
+
+    std::vector<std::thread> workers;
+    for (uint32 i = 1; i < std::min<uint32>(threads, stages.size()); ++i)
+        workers.emplace_back(&PlayerbotStartupGraph::RunStages, this);
+
+    RunStages();
+
+    for (std::thread& worker : workers)
+        worker.join();
+
+    uint32 totalTime = GetMSTimeDiffToNow(startTime);
+    uint32 stageTime = 0;
+
+    LOG_INFO("server.loading", "Playerbots startup stages:");
+    for (PlayerbotStartupStage const& stage : stages)
+    {
+        LOG_INFO("server.loading", "  {:<24} started at {:>7} ms, took {:>7} ms", stage.name, stage.startTime,
+                 stage.loadTime);
+        stageTime += stage.loadTime;
+    }
+
+    LOG_INFO("server.loading", "Playerbots startup took {} ms for {} ms of loading on {} threads", totalTime,
+             stageTime, std::max<uint32>(1, std::min<uint32>(threads, stages.size())));
+}
+
+void PlayerbotStartupGraph::RunStages()
+{
+    std::unique_lock<std::mutex> guard(lock);
+    while (finished < stages.size())
+    {
+        if (ready.empty())
+        {
+            stageFinished.wait(guard);
+            continue;
+        }
+
+        PlayerbotStartupStage& stage = stages[ready.front()];
+        ready.pop_front();
+
+        guard.unlock();
+        stage.startTime = GetMSTimeDiffToNow(startTime);
+        stage.loader();
+        stage.loadTime = GetMSTimeDiffToNow(startTime) - stage.startTime;
+        guard.lock();
+
+        ++finished;
+        for (uint32 dependent : stage.dependents)
+        {
+            if (!--stages[dependent].waitingFor)
+                ready.push_back(dependent);
+        }
+
+        stageFinished.notify_all();
+    }
+}
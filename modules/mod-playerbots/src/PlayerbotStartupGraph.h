@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, released under GNU GPL v2 license, you may redistribute it
+ * and/or modify it under version 2 of the License, or (at your option), any later version.
+ */
+
+#ifndef _PLAYERBOT_PLAYERBOTSTARTUPGRAPH_H
+#define _PLAYERBOT_PLAYERBOTSTARTUPGRAPH_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "Common.h"
+
+struct PlayerbotStartupStage
+{
+    std::string name;
+    std::function<void()> loader;
+    std::vector<std::string> dependencies;
+    std::vector<uint32> dependents;
+    uint32 waitingFor = 0;
+    uint32 startTime = 0;
+    uint32 loadTime = 0;
+};
+
+// Startup loaders with the loaders they need finished first. Loaders without a path between them run at the same
+// time, so they may only share data through their dependencies.
+class PlayerbotStartupGraph
+{
+public:
+    void Add(std::string const name, std::function<void()> loader, std::vector<std::string> const dependencies = {});
+    // runs every loader on up to the given number of threads, the calling one included, and logs their times
+    void Run(uint32 threads);
+
+private:
+    void RunStages();
+
+    std::vector<PlayerbotStartupStage> stages;
+    std::deque<uint32> ready;
+    uint32 finished = 0;
+    uint32 startTime = 0;
+    std::mutex lock;
+    std::condition_variable stageFinished;
+};
+
+#endif
@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, released under GNU GPL v2 license, you may redistribute it
+ * and/or modify it under version 2 of the License, or (at your option), any later version.
+ */
+
+#include "PlayerbotTaskScheduler.h"
+
+#include "DatabaseEnv.h"
+#include "Playerbots.h"
+
+class PlayerbotTask
+{
+public:
+    PlayerbotTask(std::function<void()>&& task) : task(std::move(task)) {}
+
+    void call() { task(); }
+
+private:
+    std::function<void()> task;
+};
+
+void PlayerbotTaskScheduler::Activate()
+{
+    if (IsActive())
+        return;
+
+    _queue = std::make_unique<ProducerConsumerQueue<PlayerbotTask*>>();
+    _workerThread = std::thread(&PlayerbotTaskScheduler::WorkerThread, this);
+}
+
+void PlayerbotTaskScheduler::Deactivate()
+{
+    if (!IsActive())
+        return;
+
+    _queue->Cancel();
+    _workerThread.join();
+    _queue.reset();
+}
+
+void PlayerbotTaskScheduler::Schedule(std::function<void()> task)
+{
+    if (!IsActive())
+    {
+        task();
+        return;
+    }
+
+    _queue->Push(new PlayerbotTask(std::move(task)));
+}
+
+void PlayerbotTaskScheduler::WorkerThread()
+{
+    CharacterDatabase.WarnAboutSyncQueries(true);
+    WorldDatabase.WarnAboutSyncQueries(true);
+    PlayerbotsDatabase.WarnAboutSyncQueries(true);
+
+    while (true)
+    {
+        PlayerbotTask* task = nullptr;
+
+        _queue->WaitAndPop(task);
+        if (!task)
+            return;
+
+        task->call();
+        delete task;
+    }
+}
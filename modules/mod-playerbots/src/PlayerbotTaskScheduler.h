@@ -0,0 +1,48 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, released under GNU GPL v2 license, you may redistribute it
+ * and/or modify it under version 2 of the License, or (at your option), any later version.
+ */
+
+#ifndef _PLAYERBOT_PLAYERBOTTASKSCHEDULER_H
+#define _PLAYERBOT_PLAYERBOTTASKSCHEDULER_H
+
+#include <functional>
+#include <memory>
+#include <thread>
+
+#include "Common.h"
+#include "PCQueue.h"
+
+class PlayerbotTask;
+
+// One long lived thread for periodic bot bookkeeping that works on data copied from the world beforehand.
+// Tasks must not touch players, maps or managers of the world, they only see what they were given.
+class PlayerbotTaskScheduler
+{
+public:
+    PlayerbotTaskScheduler() {}
+    virtual ~PlayerbotTaskScheduler() {}
+    static PlayerbotTaskScheduler* instance()
+    {
+        static PlayerbotTaskScheduler instance;
+        return &instance;
+    }
+
+    void Activate();
+    void Deactivate();
+    bool IsActive() const { return _workerThread.joinable(); }
+
+    // runs the task on the worker, or right away while the worker is not running
+    void Schedule(std::function<void()> task);
+
+private:
+    void WorkerThread();
+
+    // a cancelled queue stays cancelled, every Activate starts with a new one
+    std::unique_ptr<ProducerConsumerQueue<PlayerbotTask*>> _queue;
+    std::thread _workerThread;
+};
+
+#define sPlayerbotTaskScheduler PlayerbotTaskScheduler::instance()
+
+#endif
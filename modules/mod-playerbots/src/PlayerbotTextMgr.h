@@ -7,10 +7,13 @@
 #define _PLAYERBOT_PLAYERBOTTEXTMGR_H
 
 #include <map>
+#include <memory>
 #include <vector>
 
 #include "Common.h"
 
+class PlayerbotChatMessage;
+
 #define BOT_TEXT1(name) sPlayerbotTextMgr->GetBotText(name)
 #define BOT_TEXT2(name, replace) sPlayerbotTextMgr->GetBotText(name, replace)
 
@@ -35,15 +38,16 @@ struct ChatReplyData
 
 struct ChatQueuedReply
 {
-    ChatQueuedReply(uint32 type, uint32 guid1, uint32 guid2, std::string msg, std::string chanName, std::string name,
-                    time_t time)
-        : m_type(type), m_guid1(guid1), m_guid2(guid2), m_msg(msg), m_chanName(chanName), m_name(name), m_time(time)
+    ChatQueuedReply(uint32 type, uint32 guid1, uint32 guid2, std::shared_ptr<PlayerbotChatMessage const> message,
+                    std::string chanName, std::string name, time_t time)
+        : m_type(type), m_guid1(guid1), m_guid2(guid2), m_message(message), m_chanName(chanName), m_name(name),
+          m_time(time)
     {
     }
     uint32 m_type;
     uint32 m_guid1;
     uint32 m_guid2;
-    std::string m_msg;
+    std::shared_ptr<PlayerbotChatMessage const> m_message;
     std::string m_chanName;
     std::string m_name;
     time_t m_time;
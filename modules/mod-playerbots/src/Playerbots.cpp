@@ -23,6 +23,9 @@
 #include "DatabaseLoader.h"
 #include "GuildTaskMgr.h"
 #include "Metric.h"
+#include "PerformanceMonitor.h"
+#include "PlayerbotMapUpdater.h"
+#include "PlayerbotTaskScheduler.h"
 #include "RandomPlayerbotMgr.h"
 #include "ScriptMgr.h"
 #include "cs_playerbots.h"
@@ -81,6 +84,7 @@ public:
         if (sMetric->IsEnabled())
         {
             sMetric->LogValue("db_queue_playerbots", uint64(PlayerbotsDatabase.QueueSize()), {});
+            sPerformanceMonitor->LogMetrics();
         }
     }
 };
@@ -99,11 +103,25 @@ public:
         }
     }
 
+    void OnCreate(Player* player) override { sRandomPlayerbotMgr->OnBotCharacterCreate(player); }
+
+    void OnDeleteFromDB(CharacterDatabaseTransaction /*trans*/, uint32 guid) override
+    {
+        sRandomPlayerbotMgr->OnBotCharacterDelete(guid);
+    }
+
+    void OnLevelChanged(Player* player, uint8 /*oldlevel*/) override
+    {
+        if (player->GetSession()->IsBot())
+            sRandomPlayerbotMgr->OnBotCharacterLevelChanged(player);
+    }
+
     void OnAfterUpdate(Player* player, uint32 diff) override
     {
         if (PlayerbotAI* botAI = GET_PLAYERBOT_AI(player))
         {
-            botAI->UpdateAI(diff);
+            if (!sPlayerbotMapUpdater->Defer(player, diff))
+                botAI->UpdateAI(diff);
         }
 
         if (PlayerbotMgr* playerbotMgr = GET_PLAYERBOT_MGR(player))
@@ -172,7 +190,7 @@ public:
             }
         }
 
-        sRandomPlayerbotMgr->HandleCommand(type, msg, player);
+        sRandomPlayerbotMgr->HandleCommand(type, msg, player, channel);
     }
 
     bool OnBeforeCriteriaProgress(Player* player, AchievementCriteriaEntry const* /*criteria*/) override
@@ -240,9 +258,22 @@ public:
 
         sPlayerbotAIConfig->Initialize();
 
+        if (sPlayerbotAIConfig->enabled)
+        {
+            sPlayerbotMapUpdater->Activate(sPlayerbotAIConfig->parallelBotUpdateThreads);
+            sPlayerbotTaskScheduler->Activate();
+        }
+
         LOG_INFO("server.loading", ">> Loaded playerbots config in {} ms", GetMSTimeDiffToNow(oldMSTime));
         LOG_INFO("server.loading", " ");
     }
+
+    void OnShutdown() override
+    {
+        sPlayerbotMapUpdater->Deactivate();
+        sPlayerbotTaskScheduler->Deactivate();
+        sRandomPlayerbotMgr->FlushEvents();
+    }
 };
 
 class PlayerbotsScript : public PlayerbotScript
@@ -305,6 +336,7 @@ public:
     {
         sRandomPlayerbotMgr->UpdateAI(diff);
         sRandomPlayerbotMgr->UpdateSessions();
+        sRandomPlayerbotMgr->UpdatePopulationStats();
     }
 
     void OnPlayerbotUpdateSessions(Player* player) override
@@ -314,6 +346,8 @@ public:
                 playerbotMgr->UpdateSessions();
     }
 
+    void OnPlayerbotUpdateMap(Map* map) override { sPlayerbotMapUpdater->Update(map); }
+
     void OnPlayerbotLogout(Player* player) override
     {
         if (PlayerbotMgr* playerbotMgr = GET_PLAYERBOT_MGR(player))
@@ -6,6 +6,8 @@
 #ifndef _PLAYERBOT_H
 #define _PLAYERBOT_H
 
+#include <type_traits>
+
 #include "AiObjectContext.h"
 #include "Group.h"
 #include "Pet.h"
@@ -30,18 +32,31 @@ int strcmpi(char const* s1, char const* s2);
 #define GET_PLAYERBOT_AI(object) sPlayerbotsMgr->GetPlayerbotAI(object)
 #define GET_PLAYERBOT_MGR(object) sPlayerbotsMgr->GetPlayerbotMgr(object)
 
-#define AI_VALUE(type, name) context->GetValue<type>(name)->Get()
-#define AI_VALUE2(type, name, param) context->GetValue<type>(name, param)->Get()
+// literal names are interned once per call site, any other name is looked up by string
+#define AI_VALUE_KEY(name)                                                            \
+    ([](auto const& key) -> decltype(auto)                                            \
+    {                                                                                 \
+        if constexpr (std::is_array_v<std::remove_reference_t<decltype(key)>>)       \
+        {                                                                             \
+            static AiObjectKey const interned(key);                                   \
+            return (interned);                                                        \
+        }                                                                             \
+        else                                                                          \
+            return (key);                                                             \
+    }(name))
+
+#define AI_VALUE(type, name) context->GetValue<type>(AI_VALUE_KEY(name))->Get()
+#define AI_VALUE2(type, name, param) context->GetValue<type>(AI_VALUE_KEY(name), param)->Get()
 
-#define AI_VALUE_LAZY(type, name) context->GetValue<type>(name)->LazyGet()
-#define AI_VALUE2_LAZY(type, name, param) context->GetValue<type>(name, param)->LazyGet()
+#define AI_VALUE_LAZY(type, name) context->GetValue<type>(AI_VALUE_KEY(name))->LazyGet()
+#define AI_VALUE2_LAZY(type, name, param) context->GetValue<type>(AI_VALUE_KEY(name), param)->LazyGet()
 
-#define AI_VALUE_REF(type, name) context->GetValue<type>(name)->RefGet()
+#define AI_VALUE_REF(type, name) context->GetValue<type>(AI_VALUE_KEY(name))->RefGet()
 
-#define SET_AI_VALUE(type, name, value) context->GetValue<type>(name)->Set(value)
-#define SET_AI_VALUE2(type, name, param, value) context->GetValue<type>(name, param)->Set(value)
-#define RESET_AI_VALUE(type, name) context->GetValue<type>(name)->Reset()
-#define RESET_AI_VALUE2(type, name, param) context->GetValue<type>(name, param)->Reset()
+#define SET_AI_VALUE(type, name, value) context->GetValue<type>(AI_VALUE_KEY(name))->Set(value)
+#define SET_AI_VALUE2(type, name, param, value) context->GetValue<type>(AI_VALUE_KEY(name), param)->Set(value)
+#define RESET_AI_VALUE(type, name) context->GetValue<type>(AI_VALUE_KEY(name))->Reset()
+#define RESET_AI_VALUE2(type, name, param) context->GetValue<type>(AI_VALUE_KEY(name), param)->Reset()
 
 #define PAI_VALUE(type, name) sPlayerbotsMgr->GetPlayerbotAI(player)->GetAiObjectContext()->GetValue<type>(name)->Get()
 #define PAI_VALUE2(type, name, param) \
@@ -5,6 +5,10 @@
 
 #include "RandomItemMgr.h"
 
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+
 #include "ItemTemplate.h"
 #include "LootValues.h"
 #include "Playerbots.h"
@@ -153,6 +157,16 @@ RandomItemMgr::RandomItemMgr()
 
 void RandomItemMgr::Init()
 {
+    LoadWeightScales();
+
+    std::string const snapshotPath = GetCacheSnapshotPath();
+    uint64 snapshotKey = snapshotPath.empty() ? 0 : GetCacheSnapshotKey();
+    if (!snapshotPath.empty() && LoadCacheSnapshot(snapshotPath, snapshotKey))
+    {
+        BuildItemUpgradeIndex();
+        return;
+    }
+
     BuildItemInfoCache();
     // BuildEquipCache();
     BuildEquipCacheNew();
@@ -160,6 +174,9 @@ void RandomItemMgr::Init()
     BuildPotionCache();
     BuildFoodCache();
     BuildTradeCache();
+
+    if (!snapshotPath.empty())
+        SaveCacheSnapshot(snapshotPath, snapshotKey);
 }
 
 void RandomItemMgr::InitAfterAhBot()
@@ -168,6 +185,363 @@ void RandomItemMgr::InitAfterAhBot()
     // BuildRarityCache();
 }
 
+// FNV-1a, only needs to notice that the content a snapshot was built from changed
+class CacheSnapshotHash
+{
+public:
+    void Add(uint64 value)
+    {
+        for (uint8 i = 0; i < 8; ++i)
+        {
+            hash ^= (value >> (i * 8)) & 0xFF;
+            hash *= 1099511628211ULL;
+        }
+    }
+
+    void Add(std::string const& value)
+    {
+        Add(value.size());
+        for (char c : value)
+        {
+            hash ^= uint8(c);
+            hash *= 1099511628211ULL;
+        }
+    }
+
+    uint64 Get() const { return hash; }
+
+private:
+    uint64 hash = 14695981039346656037ULL;
+};
+
+class CacheSnapshotReader
+{
+public:
+    CacheSnapshotReader(std::vector<uint32> const& data) : data(data), pos(0), failed(false) {}
+
+    uint32 Read()
+    {
+        if (pos >= data.size())
+        {
+            failed = true;
+            return 0;
+        }
+
+        return data[pos++];
+    }
+
+    void Read(std::vector<uint32>& list)
+    {
+        uint32 size = Read();
+        if (failed || size > data.size() - pos)
+        {
+            failed = true;
+            return;
+        }
+
+        list.assign(data.begin() + pos, data.begin() + pos + size);
+        pos += size;
+    }
+
+    void Read(std::map<uint32, std::map<uint32, std::vector<uint32>>>& cache)
+    {
+        cache.clear();
+        for (uint32 outer = Read(); outer && !failed; --outer)
+        {
+            std::map<uint32, std::vector<uint32>>& lists = cache[Read()];
+            for (uint32 inner = Read(); inner && !failed; --inner)
+                Read(lists[Read()]);
+        }
+    }
+
+    void Fail() { failed = true; }
+    bool HasFailed() const { return failed; }
+    bool IsValid() const { return !failed && pos == data.size(); }
+
+private:
+    std::vector<uint32> const& data;
+    size_t pos;
+    bool failed;
+};
+
+static void WriteList(std::vector<uint32>& out, std::vector<uint32> const& list)
+{
+    out.push_back(list.size());
+    out.insert(out.end(), list.begin(), list.end());
+}
+
+static void WriteLists(std::vector<uint32>& out, std::map<uint32, std::map<uint32, std::vector<uint32>>> const& cache)
+{
+    out.push_back(cache.size());
+    for (auto const& outer : cache)
+    {
+        out.push_back(outer.first);
+        out.push_back(outer.second.size());
+        for (auto const& inner : outer.second)
+        {
+            out.push_back(inner.first);
+            WriteList(out, inner.second);
+        }
+    }
+}
+
+std::string RandomItemMgr::GetCacheSnapshotPath()
+{
+    if (sPlayerbotAIConfig->cacheSnapshotFile.empty())
+        return "";
+
+    std::filesystem::path path(sPlayerbotAIConfig->cacheSnapshotFile);
+    if (path.is_relative())
+        path = std::filesystem::path(sWorld->GetDataPath()) / path;
+
+    return path.string();
+}
+
+uint64 RandomItemMgr::GetCacheSnapshotKey()
+{
+    CacheSnapshotHash hash;
+    hash.Add(RANDOM_ITEM_SNAPSHOT_VERSION);
+    hash.Add(sWorld->getIntConfig(CONFIG_MAX_PLAYER_LEVEL));
+    hash.Add(sPlayerbotAIConfig->randomBotMaxLevel);
+
+    // templates are summed up so their order in the store does not matter
+    uint64 items = 0;
+    for (auto const& itr : *sObjectMgr->GetItemTemplateStore())
+    {
+        ItemTemplate const* proto = &itr.second;
+
+        CacheSnapshotHash item;
+        for (uint64 value : std::initializer_list<uint64>{
+                 proto->ItemId, proto->Class, proto->SubClass, proto->Quality, proto->Flags, proto->Bonding,
+                 proto->ItemLevel, proto->RequiredLevel, proto->RequiredSkill, proto->InventoryType, proto->Duration,
+                 uint32(proto->Stackable), proto->Area, proto->Map, proto->RequiredCityRank, proto->RequiredHonorRank,
+                 proto->SellPrice})
+            item.Add(value);
+
+        item.Add(proto->Name1);
+
+        for (uint8 j = 0; j < MAX_ITEM_PROTO_SPELLS; j++)
+        {
+            item.Add(proto->Spells[j].SpellId);
+            item.Add(proto->Spells[j].SpellCategory);
+
+            if (SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(proto->Spells[j].SpellId))
+            {
+                for (uint8 i = 0; i < 3; i++)
+                    item.Add(spellInfo->Effects[i].Effect);
+            }
+        }
+
+        items += item.Get();
+    }
+
+    hash.Add(items);
+
+    uint64 quests = 0;
+    for (auto const& itr : sObjectMgr->GetQuestTemplates())
+    {
+        Quest const* quest = itr.second;
+
+        CacheSnapshotHash reward;
+        reward.Add(itr.first);
+        reward.Add(quest->IsRepeatable());
+        reward.Add(uint32(quest->GetQuestLevel()));
+        reward.Add(quest->GetRequiredClasses());
+        for (uint32 j = 0; j < QUEST_REWARD_CHOICES_COUNT; j++)
+            reward.Add(quest->RewardChoiceItemId[j]);
+
+        for (uint32 j = 0; j < QUEST_REWARDS_COUNT; j++)
+            reward.Add(quest->RewardItemId[j]);
+
+        quests += reward.Get();
+    }
+
+    hash.Add(quests);
+
+    // without weight scales the item info pass stops before it finds the test items
+    for (uint8 cls = CLASS_WARRIOR; cls < MAX_CLASSES; ++cls)
+    {
+        for (auto const& spec : m_weightScales[cls])
+        {
+            hash.Add(spec.second.info.id);
+            hash.Add(spec.second.info.name);
+        }
+    }
+
+    return hash.Get();
+}
+
+bool RandomItemMgr::LoadCacheSnapshot(std::string const& path, uint64 key)
+{
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file)
+        return false;
+
+    std::streamsize size = file.tellg();
+    if (size < 16 || size % sizeof(uint32))
+    {
+        LOG_INFO("server.loading", "Random item cache snapshot {} is damaged, rebuilding", path);
+        return false;
+    }
+
+    std::vector<uint32> data(size / sizeof(uint32));
+    file.seekg(0);
+    if (!file.read(reinterpret_cast<char*>(data.data()), size))
+        return false;
+
+    if (data[0] != RANDOM_ITEM_SNAPSHOT_MAGIC || data[1] != RANDOM_ITEM_SNAPSHOT_VERSION ||
+        data[2] != uint32(key) || data[3] != uint32(key >> 32))
+    {
+        LOG_INFO("server.loading", "Random item cache snapshot {} is outdated, rebuilding", path);
+        return false;
+    }
+
+    data.erase(data.begin(), data.begin() + 4);
+    CacheSnapshotReader reader(data);
+
+    std::vector<uint32> testItems;
+    reader.Read(testItems);
+
+    // entries are saved sorted by item id, so they are kept in place instead of being sorted again
+    std::vector<ItemInfoEntry> infoCache;
+    uint32 infoCount = reader.Read();
+    if (infoCount <= data.size())
+        infoCache.reserve(infoCount);
+
+    for (; infoCount && !reader.HasFailed(); --infoCount)
+    {
+        ItemInfoEntry& info = infoCache.emplace_back();
+        info.itemId = reader.Read();
+        info.minLevel = reader.Read();
+        info.source = reader.Read();
+        info.sourceId = reader.Read();
+        info.team = reader.Read();
+        info.repRank = reader.Read();
+        info.repFaction = reader.Read();
+        info.quality = reader.Read();
+        info.slot = reader.Read();
+        for (uint32 weights = reader.Read(); weights && !reader.HasFailed(); --weights)
+        {
+            uint32 specId = reader.Read();
+            uint32 weight = reader.Read();
+            if (specId <= MAX_STAT_SCALES)
+                info.weights[specId] = weight;
+        }
+
+        if (infoCache.size() > 1 && infoCache[infoCache.size() - 2].itemId >= info.itemId)
+            reader.Fail();
+    }
+
+    std::map<uint32, std::map<uint32, std::vector<uint32>>> equipCache;
+    reader.Read(equipCache);
+
+    std::map<uint32, std::map<uint32, uint32>> ammo;
+    for (uint32 count = reader.Read(); count && !reader.HasFailed(); --count)
+    {
+        uint32 level = reader.Read();
+        uint32 subClass = reader.Read();
+        ammo[level][subClass] = reader.Read();
+    }
+
+    std::map<uint32, std::map<uint32, std::vector<uint32>>> potions;
+    reader.Read(potions);
+
+    std::map<uint32, std::map<uint32, std::vector<uint32>>> food;
+    reader.Read(food);
+
+    std::map<uint32, std::vector<uint32>> trade;
+    for (uint32 count = reader.Read(); count && !reader.HasFailed(); --count)
+        reader.Read(trade[reader.Read()]);
+
+    if (!reader.IsValid())
+    {
+        LOG_INFO("server.loading", "Random item cache snapshot {} is damaged, rebuilding", path);
+        return false;
+    }
+
+    itemForTest.insert(testItems.begin(), testItems.end());
+    itemInfoCache = std::move(infoCache);
+    equipCacheNew = std::move(equipCache);
+    ammoCache = std::move(ammo);
+    potionCache = std::move(potions);
+    foodCache = std::move(food);
+    tradeCache = std::move(trade);
+
+    LOG_INFO("server.loading", "Loaded random item caches from snapshot {}", path);
+    return true;
+}
+
+void RandomItemMgr::SaveCacheSnapshot(std::string const& path, uint64 key)
+{
+    std::vector<uint32> data = {RANDOM_ITEM_SNAPSHOT_MAGIC, RANDOM_ITEM_SNAPSHOT_VERSION, uint32(key),
+                                uint32(key >> 32)};
+
+    WriteList(data, std::vector<uint32>(itemForTest.begin(), itemForTest.end()));
+
+    data.push_back(itemInfoCache.size());
+    for (ItemInfoEntry const& info : itemInfoCache)
+    {
+        for (uint32 value : {info.itemId, info.minLevel, info.source, info.sourceId, info.team, info.repRank,
+                             info.repFaction, info.quality, info.slot})
+            data.push_back(value);
+
+        data.push_back(MAX_STAT_SCALES);
+        for (uint32 specId = 1; specId <= MAX_STAT_SCALES; ++specId)
+        {
+            data.push_back(specId);
+            data.push_back(info.weights[specId]);
+        }
+    }
+
+    WriteLists(data, equipCacheNew);
+
+    uint32 ammoCount = 0;
+    for (auto const& level : ammoCache)
+        ammoCount += level.second.size();
+
+    data.push_back(ammoCount);
+    for (auto const& level : ammoCache)
+    {
+        for (auto const& subClass : level.second)
+        {
+            data.push_back(level.first);
+            data.push_back(subClass.first);
+            data.push_back(subClass.second);
+        }
+    }
+
+    WriteLists(data, potionCache);
+    WriteLists(data, foodCache);
+
+    data.push_back(tradeCache.size());
+    for (auto const& level : tradeCache)
+    {
+        data.push_back(level.first);
+        WriteList(data, level.second);
+    }
+
+    // written aside first, a server stopped halfway must not leave a damaged snapshot behind
+    std::string const tempPath = path + ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file.write(reinterpret_cast<char const*>(data.data()), data.size() * sizeof(uint32)))
+        {
+            LOG_ERROR("playerbots", "Could not write random item cache snapshot {}", tempPath);
+            return;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(tempPath, path, error);
+    if (error)
+    {
+        LOG_ERROR("playerbots", "Could not write random item cache snapshot {}: {}", path, error.message());
+        return;
+    }
+
+    LOG_INFO("server.loading", "Saved random item caches to snapshot {}", path);
+}
+
 RandomItemMgr::~RandomItemMgr()
 {
     for (std::map<RandomItemType, RandomItemPredicate*>::iterator i = predicates.begin(); i != predicates.end(); ++i)
@@ -180,10 +554,16 @@ bool RandomItemMgr::HandleConsoleCommand(ChatHandler* handler, char const* args)
 {
     if (!args || !*args)
     {
-        LOG_ERROR("playerbots", "Usage: rnditem");
+        LOG_ERROR("playerbots", "Usage: rnditem upgradebench");
         return false;
     }
 
+    if (!strcmp(args, "upgradebench"))
+    {
+        sRandomItemMgr->BenchmarkUpgrades();
+        return true;
+    }
+
     return false;
 }
 
@@ -831,10 +1211,8 @@ bool RandomItemMgr::CanEquipWeapon(uint8 clazz, ItemTemplate const* proto)
     return true;
 }
 
-void RandomItemMgr::BuildItemInfoCache()
+void RandomItemMgr::LoadWeightScales()
 {
-    uint32 maxLevel = sWorld->getIntConfig(CONFIG_MAX_PLAYER_LEVEL);
-
     // load weightscales
     LOG_INFO("playerbots", "Loading weightscales info");
 
@@ -899,6 +1277,11 @@ void RandomItemMgr::BuildItemInfoCache()
 
         LOG_INFO("playerbots", "Loaded {} weightscale stat weights", statcount);
     }
+}
+
+void RandomItemMgr::BuildItemInfoCache()
+{
+    uint32 maxLevel = sWorld->getIntConfig(CONFIG_MAX_PLAYER_LEVEL);
 
     if (m_weightScales[1].empty())
     {
@@ -994,277 +1377,282 @@ void RandomItemMgr::BuildItemInfoCache()
             proto->RequiredReputationRank > 0)
             continue;*/
 
-        // if (proto->RequiredHonorRank > 0 || proto->RequiredSkillRank > 0 || proto->RequiredCityRank > 0)
-        //     continue;
+        if (proto->RequiredHonorRank > 0 || proto->RequiredSkillRank > 0 || proto->RequiredCityRank > 0)
+            continue;
 
-        // // skip random enchant items
-        // if (proto->RandomProperty)
-        //     continue;
+        // skip random enchant items
+        if (proto->RandomProperty)
+            continue;
 
-        // // skip heirloom items
-        // if (proto->Quality == ITEM_QUALITY_HEIRLOOM)
-        //     continue;
+        // skip heirloom items
+        if (proto->Quality == ITEM_QUALITY_HEIRLOOM)
+            continue;
 
-        // // check possible equip slots
-        // EquipmentSlots slot = EQUIPMENT_SLOT_START;
-        // for (std::map<EquipmentSlots, std::set<InventoryType> >::iterator i = viableSlots.begin();
-        //      i != viableSlots.end(); ++i)
-        // {
-        //     std::set<InventoryType> slots = viableSlots[(EquipmentSlots)i->first];
-        //     if (slots.find((InventoryType)proto->InventoryType) != slots.end())
-        //         slot = i->first;
-        // }
-
-        // if (slot == EQUIPMENT_SLOT_START)
-        //     continue;
+        // check possible equip slots
+        EquipmentSlots slot = EQUIPMENT_SLOT_START;
+        for (std::map<EquipmentSlots, std::set<InventoryType> >::iterator i = viableSlots.begin();
+             i != viableSlots.end(); ++i)
+        {
+            std::set<InventoryType> slots = viableSlots[(EquipmentSlots)i->first];
+            if (slots.find((InventoryType)proto->InventoryType) != slots.end())
+                slot = i->first;
+        }
+
+        if (slot == EQUIPMENT_SLOT_START)
+            continue;
 
         // Init Item cache
-        // ItemInfoEntry cacheInfo;
-
-        // for (uint8 clazz = CLASS_WARRIOR; clazz < MAX_CLASSES; ++clazz)
-        // {
-        //     // skip nonexistent classes
-        //     if (!((1 << (clazz - 1)) & CLASSMASK_ALL_PLAYABLE) || !sChrClassesStore.LookupEntry(clazz))
-        //         continue;
-
-        //     // skip wrong classes
-        //     if ((proto->AllowableClass & (1 << (clazz - 1))) == 0)
-        //         continue;
-
-        //     for (uint32 spec = 1; spec < 5; ++spec)
-        //     {
-        //         if (!m_weightScales[clazz][spec].info.id)
-        //             continue;
-
-        //         // check possible armor for spec
-        //         if (m_weightScales)
-        //         if (proto->Class == ITEM_CLASS_ARMOR && (
-        //             slot == EQUIPMENT_SLOT_HEAD ||
-        //             slot == EQUIPMENT_SLOT_SHOULDERS ||
-        //             slot == EQUIPMENT_SLOT_CHEST ||
-        //             slot == EQUIPMENT_SLOT_WAIST ||
-        //             slot == EQUIPMENT_SLOT_LEGS ||
-        //             slot == EQUIPMENT_SLOT_FEET ||
-        //             slot == EQUIPMENT_SLOT_WRISTS ||
-        //             slot == EQUIPMENT_SLOT_HANDS) &&
-        //             !ShouldEquipArmorForSpec(clazz, spec, proto))
-        //             continue;
-
-        //         // check possible weapon for spec
-        //         if ((proto->Class == ITEM_CLASS_WEAPON || (proto->SubClass == ITEM_SUBCLASS_ARMOR_SHIELD ||
-        //         (proto->SubClass == ITEM_SUBCLASS_ARMOR_MISC && proto->InventoryType == INVTYPE_HOLDABLE))) &&
-        //             !ShouldEquipWeaponForSpec(clazz, spec, proto))
-        //             continue;
-
-        //         StatWeight statWeight;
-        //         statWeight.id = m_weightScales[clazz][spec].info.id;
-        //         uint32 statW = CalculateStatWeight(clazz, spec, proto);
-        //         // set stat weight = 1 for items that can be equipped but have no proper stats
-        //         statWeight.weight = statW ? statW : 1;
-        //         //statWeight.weight = statW;
-        //         // save item statWeight into ItemCache
-        //         cacheInfo.weights[statWeight.id] = statWeight.weight;
-        //         LOG_DEBUG("playerbots", "Item: {}, weight: {}, class: {}, spec: {}", proto->ItemId,
-        //         statWeight.weight, clazz, m_weightScales[clazz][spec].info.name);
-        //     }
-        // }
-
-        // cacheInfo.team = TEAM_NEUTRAL;
-
-        // // check faction
-        // if (proto->Flags2 & ITEM_FLAG2_FACTION_HORDE)
-        //     cacheInfo.team = TEAM_HORDE;
-
-        // if (proto->Flags2 & ITEM_FLAG2_FACTION_ALLIANCE)
-        //     cacheInfo.team = TEAM_ALLIANCE;
-
-        // if (cacheInfo.team == TEAM_NEUTRAL && proto->AllowableRace > 1 && proto->AllowableRace < 8388607)
-        // {
-        //     if (FactionEntry const* faction = sFactionStore.LookupEntry(HORDE))
-        //         if ((proto->AllowableRace & faction->BaseRepRaceMask[0]) != 0)
-        //             cacheInfo.team = TEAM_HORDE;
-
-        //     if (FactionEntry const* faction = sFactionStore.LookupEntry(ALLIANCE))
-        //         if ((proto->AllowableRace & faction->BaseRepRaceMask[0]) != 0)
-        //             cacheInfo.team = TEAM_ALLIANCE;
-        // }
-
-        // if (cacheInfo.team < TEAM_NEUTRAL)
-        //     LOG_DEBUG("playerbots", "Item: {}, team (item): {}", proto->ItemId, cacheInfo.team == TEAM_ALLIANCE ?
-        //     "Alliance" : "Horde");
-
-        // // check min level
-        // if (proto->RequiredLevel)
-        //     cacheInfo.minLevel = proto->RequiredLevel;
-
-        // // check item source
-
-        // if (proto->Flags & ITEM_FLAG_NO_DISENCHANT)
-        // {
-        //     cacheInfo.source = ITEM_SOURCE_PVP;
-        //     LOG_DEBUG("playerbots", "Item: {}, source: PvP Reward", proto->ItemId);
-        // }
-
-        // // check quests
-        // if (cacheInfo.source == ITEM_SOURCE_NONE)
-        // {
-        //     std::vector<uint32> questIds = GetQuestIdsForItem(proto->ItemId);
-        //     if (questIds.size())
-        //     {
-        //         bool isAlly = false;
-        //         bool isHorde = false;
-        //         for (std::vector<uint32>::iterator i = questIds.begin(); i != questIds.end(); ++i)
-        //         {
-        //             Quest const* quest = sObjectMgr->GetQuestTemplate(*i);
-        //             if (quest)
-        //             {
-        //                 cacheInfo.source = ITEM_SOURCE_QUEST;
-        //                 cacheInfo.sourceId = *i;
-        //                 if (!cacheInfo.minLevel)
-        //                     cacheInfo.minLevel = quest->GetMinLevel();
-
-        //                 // check quest team
-        //                 if (cacheInfo.team == TEAM_NEUTRAL)
-        //                 {
-        //                     uint32 reqRace = quest->GetAllowableRaces();
-        //                     if (reqRace)
-        //                     {
-        //                         if ((reqRace & RACEMASK_ALLIANCE) != 0)
-        //                             isAlly = true;
-        //                         else if ((reqRace & RACEMASK_HORDE) != 0)
-        //                             isHorde = true;
-        //                     }
-        //                 }
-        //             }
-        //         }
-
-        //         if (isAlly && isHorde)
-        //             cacheInfo.team = TEAM_NEUTRAL;
-        //         else if (isAlly)
-        //             cacheInfo.team = TEAM_ALLIANCE;
-        //         else if (isHorde)
-        //             cacheInfo.team = TEAM_HORDE;
-
-        //         LOG_DEBUG("playerbots", "Item: {}, team (quest): {}", proto->ItemId, cacheInfo.team == TEAM_ALLIANCE
-        //         ? "Alliance" : cacheInfo.team == TEAM_HORDE ? "Horde" : "Both"); LOG_DEBUG("playerbots", "Item: {},
-        //         source: quest {}, minlevel: {}", proto->ItemId, cacheInfo.sourceId, cacheInfo.minLevel);
-        //     }
-        // }
-
-        // if (cacheInfo.minLevel)
-        //     LOG_DEBUG("playerbots", "Item: {}, minlevel: {}", proto->ItemId, cacheInfo.minLevel);
-
-        // // check vendors
-        // if (cacheInfo.source == ITEM_SOURCE_NONE)
-        // {
-        //     for (std::set<uint32>::iterator i = vendorItems.begin(); i != vendorItems.end(); ++i)
-        //     {
-        //         if (proto->ItemId == *i)
-        //         {
-        //             cacheInfo.source = ITEM_SOURCE_VENDOR;
-        //             LOG_DEBUG("playerbots", "Item: {} source: vendor", proto->ItemId);
-        //             break;
-        //         }
-        //     }
-        // }
-
-        // // check drops
-        // std::vector<int32> creatures;
-        // std::vector<int32> gameobjects;
-        // auto range = dropMap->equal_range(itr.first);
-
-        // for (auto iter = range.first; iter != range.second; ++iter)
-        // {
-        //     if (iter->second > 0)
-        //         creatures.push_back(iter->second);
-        //     else
-        //         gameobjects.push_back(abs(iter->second));
-        // }
-
-        // // check creature drop
-        // if (cacheInfo.source == ITEM_SOURCE_NONE)
-        // {
-        //     if (creatures.size())
-        //     {
-        //         if (creatures.size() == 1)
-        //         {
-        //             cacheInfo.source = ITEM_SOURCE_DROP;
-        //             cacheInfo.sourceId = creatures.front();
-        //             LOG_DEBUG("playerbots", "Item: {}, source: creature drop, ID: {}", proto->ItemId,
-        //             creatures.front());
-        //         }
-        //         else
-        //         {
-        //             cacheInfo.source = ITEM_SOURCE_DROP;
-        //             LOG_DEBUG("playerbots", "Item: {}, source: creatures drop, number: {}", proto->ItemId,
-        //             creatures.size());
-        //         }
-        //     }
-        // }
-
-        // // check gameobject drop
-        // if (cacheInfo.source == ITEM_SOURCE_NONE || (cacheInfo.source == ITEM_SOURCE_DROP && !cacheInfo.sourceId))
-        // {
-        //     if (gameobjects.size())
-        //     {
-        //         if (gameobjects.size() == 1)
-        //         {
-        //             cacheInfo.source = ITEM_SOURCE_DROP;
-        //             cacheInfo.sourceId = gameobjects.front();
-        //             LOG_INFO("playerbots", "Item: {}, source: gameobject, ID: {}", proto->ItemId,
-        //             gameobjects.front());
-        //         }
-        //         else
-        //         {
-        //             cacheInfo.source = ITEM_SOURCE_DROP;
-        //             LOG_INFO("playerbots", "Item: {}, source: gameobjects, number: {}", proto->ItemId,
-        //             gameobjects.size());
-        //         }
-        //     }
-        // }
-
-        // // check faction
-        // if (proto->RequiredReputationFaction > 0 && proto->RequiredReputationFaction != 35 &&
-        // proto->RequiredReputationRank < 15)
-        // {
-        //     cacheInfo.repFaction = proto->RequiredReputationFaction;
-        //     cacheInfo.repRank = proto->RequiredReputationRank;
-        // }
-
-        // cacheInfo.quality = proto->Quality;
-        // cacheInfo.itemId = proto->ItemId;
-        // cacheInfo.slot = slot;
-
-        // // save cache
-        // PlayerbotsDatabasePreparedStatement* stmt =
-        // PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_DEL_EQUIP_CACHE_NEW); stmt->SetData(0, proto->ItemId);
-        // trans->Append(stmt);
-
-        // stmt = PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_INS_EQUIP_CACHE_NEW);
-        // stmt->SetData(0, cacheInfo.itemId);
-        // stmt->SetData(1, cacheInfo.quality);
-        // stmt->SetData(2, cacheInfo.slot);
-        // stmt->SetData(3, cacheInfo.source);
-        // stmt->SetData(4, cacheInfo.sourceId);
-        // stmt->SetData(5, cacheInfo.team);
-        // stmt->SetData(6, cacheInfo.repFaction);
-        // stmt->SetData(7, cacheInfo.repRank);
-        // stmt->SetData(8, cacheInfo.minLevel);
-
-        // for (uint8 i = 1; i <= MAX_STAT_SCALES; ++i)
-        // {
-        //     if (cacheInfo.weights[i])
-        //         stmt->SetData(8 + i, cacheInfo.weights[i]);
-        //     else
-        //         stmt->SetData(8 + i, 0);
-        // }
-
-        // trans->Append(stmt);
-
-        // itemInfoCache[cacheInfo.itemId] = std::move(cacheInfo);
+        ItemInfoEntry cacheInfo;
+
+        for (uint8 clazz = CLASS_WARRIOR; clazz < MAX_CLASSES; ++clazz)
+        {
+            // skip nonexistent classes
+            if (!((1 << (clazz - 1)) & CLASSMASK_ALL_PLAYABLE) || !sChrClassesStore.LookupEntry(clazz))
+                continue;
+
+            // skip wrong classes
+            if ((proto->AllowableClass & (1 << (clazz - 1))) == 0)
+                continue;
+
+            for (uint32 spec = 1; spec < 5; ++spec)
+            {
+                if (!m_weightScales[clazz][spec].info.id)
+                    continue;
+
+                // check possible armor for spec
+                if (proto->Class == ITEM_CLASS_ARMOR &&
+                    (slot == EQUIPMENT_SLOT_HEAD || slot == EQUIPMENT_SLOT_SHOULDERS || slot == EQUIPMENT_SLOT_CHEST ||
+                     slot == EQUIPMENT_SLOT_WAIST || slot == EQUIPMENT_SLOT_LEGS || slot == EQUIPMENT_SLOT_FEET ||
+                     slot == EQUIPMENT_SLOT_WRISTS || slot == EQUIPMENT_SLOT_HANDS) &&
+                    !ShouldEquipArmorForSpec(clazz, spec, proto))
+                    continue;
+
+                // check possible weapon for spec
+                if ((proto->Class == ITEM_CLASS_WEAPON ||
+                     (proto->SubClass == ITEM_SUBCLASS_ARMOR_SHIELD ||
+                      (proto->SubClass == ITEM_SUBCLASS_ARMOR_MISC && proto->InventoryType == INVTYPE_HOLDABLE))) &&
+                    !ShouldEquipWeaponForSpec(clazz, spec, proto))
+                    continue;
+
+                // the snapshot and the cache table only hold MAX_STAT_SCALES weights
+                if (m_weightScales[clazz][spec].info.id > MAX_STAT_SCALES)
+                    continue;
+
+                StatWeight statWeight;
+                statWeight.id = m_weightScales[clazz][spec].info.id;
+                uint32 statW = CalculateStatWeight(clazz, spec, proto);
+                // set stat weight = 1 for items that can be equipped but have no proper stats
+                statWeight.weight = statW ? statW : 1;
+                // save item statWeight into ItemCache
+                cacheInfo.weights[statWeight.id] = statWeight.weight;
+                LOG_DEBUG("playerbots", "Item: {}, weight: {}, class: {}, spec: {}", proto->ItemId,
+                          statWeight.weight, clazz, m_weightScales[clazz][spec].info.name);
+            }
+        }
+
+        cacheInfo.team = TEAM_NEUTRAL;
+
+        // check faction
+        if (proto->Flags2 & ITEM_FLAG2_FACTION_HORDE)
+            cacheInfo.team = TEAM_HORDE;
+
+        if (proto->Flags2 & ITEM_FLAG2_FACTION_ALLIANCE)
+            cacheInfo.team = TEAM_ALLIANCE;
+
+        if (cacheInfo.team == TEAM_NEUTRAL && proto->AllowableRace > 1 && proto->AllowableRace < 8388607)
+        {
+            if (FactionEntry const* faction = sFactionStore.LookupEntry(HORDE))
+                if ((proto->AllowableRace & faction->BaseRepRaceMask[0]) != 0)
+                    cacheInfo.team = TEAM_HORDE;
+
+            if (FactionEntry const* faction = sFactionStore.LookupEntry(ALLIANCE))
+                if ((proto->AllowableRace & faction->BaseRepRaceMask[0]) != 0)
+                    cacheInfo.team = TEAM_ALLIANCE;
+        }
+
+        if (cacheInfo.team < TEAM_NEUTRAL)
+            LOG_DEBUG("playerbots", "Item: {}, team (item): {}", proto->ItemId,
+                      cacheInfo.team == TEAM_ALLIANCE ? "Alliance" : "Horde");
+
+        // check min level
+        if (proto->RequiredLevel)
+            cacheInfo.minLevel = proto->RequiredLevel;
+
+        // check item source
+        if (proto->Flags & ITEM_FLAG_NO_DISENCHANT)
+        {
+            cacheInfo.source = ITEM_SOURCE_PVP;
+            LOG_DEBUG("playerbots", "Item: {}, source: PvP Reward", proto->ItemId);
+        }
+
+        // check quests
+        if (cacheInfo.source == ITEM_SOURCE_NONE)
+        {
+            std::vector<uint32> questIds = GetQuestIdsForItem(proto->ItemId);
+            if (questIds.size())
+            {
+                bool isAlly = false;
+                bool isHorde = false;
+                for (std::vector<uint32>::iterator i = questIds.begin(); i != questIds.end(); ++i)
+                {
+                    Quest const* quest = sObjectMgr->GetQuestTemplate(*i);
+                    if (quest)
+                    {
+                        cacheInfo.source = ITEM_SOURCE_QUEST;
+                        cacheInfo.sourceId = *i;
+                        if (!cacheInfo.minLevel)
+                            cacheInfo.minLevel = quest->GetMinLevel();
+
+                        // check quest team
+                        if (cacheInfo.team == TEAM_NEUTRAL)
+                        {
+                            uint32 reqRace = quest->GetAllowableRaces();
+                            if (reqRace)
+                            {
+                                if ((reqRace & RACEMASK_ALLIANCE) != 0)
+                                    isAlly = true;
+                                else if ((reqRace & RACEMASK_HORDE) != 0)
+                                    isHorde = true;
+                            }
+                        }
+                    }
+                }
+
+                if (isAlly && isHorde)
+                    cacheInfo.team = TEAM_NEUTRAL;
+                else if (isAlly)
+                    cacheInfo.team = TEAM_ALLIANCE;
+                else if (isHorde)
+                    cacheInfo.team = TEAM_HORDE;
+
+                LOG_DEBUG("playerbots", "Item: {}, team (quest): {}", proto->ItemId,
+                          cacheInfo.team == TEAM_ALLIANCE ? "Alliance"
+                          : cacheInfo.team == TEAM_HORDE  ? "Horde"
+                                                          : "Both");
+                LOG_DEBUG("playerbots", "Item: {}, source: quest {}, minlevel: {}", proto->ItemId, cacheInfo.sourceId,
+                          cacheInfo.minLevel);
+            }
+        }
+
+        if (cacheInfo.minLevel)
+            LOG_DEBUG("playerbots", "Item: {}, minlevel: {}", proto->ItemId, cacheInfo.minLevel);
+
+        // check vendors
+        if (cacheInfo.source == ITEM_SOURCE_NONE)
+        {
+            for (std::set<uint32>::iterator i = vendorItems.begin(); i != vendorItems.end(); ++i)
+            {
+                if (proto->ItemId == *i)
+                {
+                    cacheInfo.source = ITEM_SOURCE_VENDOR;
+                    LOG_DEBUG("playerbots", "Item: {} source: vendor", proto->ItemId);
+                    break;
+                }
+            }
+        }
+
+        // check drops
+        std::vector<int32> creatures;
+        std::vector<int32> gameobjects;
+        auto range = dropMap->equal_range(itr.first);
+
+        for (auto iter = range.first; iter != range.second; ++iter)
+        {
+            if (iter->second > 0)
+                creatures.push_back(iter->second);
+            else
+                gameobjects.push_back(abs(iter->second));
+        }
+
+        // check creature drop
+        if (cacheInfo.source == ITEM_SOURCE_NONE)
+        {
+            if (creatures.size())
+            {
+                if (creatures.size() == 1)
+                {
+                    cacheInfo.source = ITEM_SOURCE_DROP;
+                    cacheInfo.sourceId = creatures.front();
+                    LOG_DEBUG("playerbots", "Item: {}, source: creature drop, ID: {}", proto->ItemId,
+                              creatures.front());
+                }
+                else
+                {
+                    cacheInfo.source = ITEM_SOURCE_DROP;
+                    LOG_DEBUG("playerbots", "Item: {}, source: creatures drop, number: {}", proto->ItemId,
+                              creatures.size());
+                }
+            }
+        }
+
+        // check gameobject drop
+        if (cacheInfo.source == ITEM_SOURCE_NONE || (cacheInfo.source == ITEM_SOURCE_DROP && !cacheInfo.sourceId))
+        {
+            if (gameobjects.size())
+            {
+                if (gameobjects.size() == 1)
+                {
+                    cacheInfo.source = ITEM_SOURCE_DROP;
+                    cacheInfo.sourceId = gameobjects.front();
+                    LOG_INFO("playerbots", "Item: {}, source: gameobject, ID: {}", proto->ItemId,
+                             gameobjects.front());
+                }
+                else
+                {
+                    cacheInfo.source = ITEM_SOURCE_DROP;
+                    LOG_INFO("playerbots", "Item: {}, source: gameobjects, number: {}", proto->ItemId,
+                             gameobjects.size());
+                }
+            }
+        }
+
+        // check faction
+        if (proto->RequiredReputationFaction > 0 && proto->RequiredReputationFaction != 35 &&
+            proto->RequiredReputationRank < 15)
+        {
+            cacheInfo.repFaction = proto->RequiredReputationFaction;
+            cacheInfo.repRank = proto->RequiredReputationRank;
+        }
+
+        cacheInfo.quality = proto->Quality;
+        cacheInfo.itemId = proto->ItemId;
+        cacheInfo.slot = slot;
+
+        // save cache
+        PlayerbotsDatabasePreparedStatement* stmt =
+            PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_DEL_EQUIP_CACHE_NEW);
+        stmt->SetData(0, proto->ItemId);
+        trans->Append(stmt);
+
+        stmt = PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_INS_EQUIP_CACHE_NEW);
+        stmt->SetData(0, cacheInfo.itemId);
+        stmt->SetData(1, cacheInfo.quality);
+        stmt->SetData(2, cacheInfo.slot);
+        stmt->SetData(3, cacheInfo.source);
+        stmt->SetData(4, cacheInfo.sourceId);
+        stmt->SetData(5, cacheInfo.team);
+        stmt->SetData(6, cacheInfo.repFaction);
+        stmt->SetData(7, cacheInfo.repRank);
+        stmt->SetData(8, cacheInfo.minLevel);
+
+        for (uint8 i = 1; i <= MAX_STAT_SCALES; ++i)
+            stmt->SetData(8 + i, cacheInfo.weights[i]);
+
+        trans->Append(stmt);
+
+        itemInfoCache.push_back(std::move(cacheInfo));
+
     }
 
     PlayerbotsDatabase.CommitTransaction(trans);
+
+    // the item template store is unordered, FindItemInfo needs the cache by id
+    std::sort(itemInfoCache.begin(), itemInfoCache.end(),
+              [](ItemInfoEntry const& a, ItemInfoEntry const& b) { return a.itemId < b.itemId; });
+
+    LOG_INFO("playerbots", "Cached stat weights of {} items", itemInfoCache.size());
+
+    BuildItemUpgradeIndex();
 }
 
 uint32 RandomItemMgr::CalculateStatWeight(uint8 playerclass, uint8 spec, ItemTemplate const* proto)
@@ -1703,121 +2091,174 @@ std::vector<uint32> RandomItemMgr::GetQuestIdsForItem(uint32 itemId)
     return std::move(questIds);
 }
 
-uint32 RandomItemMgr::GetUpgrade(Player* player, std::string spec, uint8 slot, uint32 quality, uint32 itemId)
+void RandomItemMgr::BuildItemUpgradeIndex()
 {
-    if (!player)
-        return 0;
+    upgradeIndex.clear();
 
-    // get old item statWeight
-    uint32 oldStatWeight = 0;
-    uint32 specId = 0;
-    uint32 closestUpgrade = 0;
-    uint32 closestUpgradeWeight = 0;
-    std::vector<uint32> classspecs;
+    for (uint32 i = 0; i < itemInfoCache.size(); ++i)
+        upgradeIndex[std::make_pair(itemInfoCache[i].slot, itemInfoCache[i].team)].push_back(i);
 
-    for (uint32 specNum = 1; specNum < 5; ++specNum)
+    // items are added by id, queries need them by level
+    for (auto& list : upgradeIndex)
     {
-        if (!m_weightScales[player->getClass()][specNum].info.id)
-            continue;
-
-        classspecs.push_back(m_weightScales[player->getClass()][specNum].info.id);
-
-        if (m_weightScales[player->getClass()][specNum].info.name == spec)
-            specId = m_weightScales[player->getClass()][specNum].info.id;
+        std::stable_sort(list.second.begin(), list.second.end(), [this](uint32 a, uint32 b)
+                         { return itemInfoCache[a].minLevel < itemInfoCache[b].minLevel; });
     }
-    if (!specId)
-        return 0;
-
-    if (itemId && itemInfoCache.find(itemId) != itemInfoCache.end())
-    {
-        oldStatWeight = itemInfoCache[itemId].weights[specId];
 
-        if (oldStatWeight)
-            LOG_INFO("playerbots", "Old Item: {}, weight: {}", itemId, oldStatWeight);
-        else
-            LOG_INFO("playerbots", "Old item has no stat weight");
-    }
+    LOG_INFO("playerbots", "Indexed {} item upgrades in {} lists", itemInfoCache.size(), upgradeIndex.size());
+}
 
-    for (std::map<uint32, ItemInfoEntry>::iterator i = itemInfoCache.begin(); i != itemInfoCache.end(); ++i)
+uint32 RandomItemMgr::GetSpecId(uint8 cls, std::string const spec, std::vector<uint32>& classSpecs)
+{
+    uint32 specId = 0;
+    for (uint32 specNum = 1; specNum < 5; ++specNum)
     {
-        ItemInfoEntry& info = i->second;
-
-        // skip useless items
-        if (info.weights[specId] == 0)
+        if (!m_weightScales[cls][specNum].info.id)
             continue;
 
-        // skip higher lvl
-        if (info.minLevel > player->GetLevel())
-            continue;
+        classSpecs.push_back(m_weightScales[cls][specNum].info.id);
 
-        // skip too low level
-        if (info.minLevel < (player->GetLevel() - 10))
-            continue;
+        if (m_weightScales[cls][specNum].info.name == spec)
+            specId = m_weightScales[cls][specNum].info.id;
+    }
 
-        // skip wrong team
-        if (info.team != TEAM_NEUTRAL && info.team != player->GetTeamId())
-            continue;
+    return specId;
+}
 
-        // skip wrong slot
-        if ((EquipmentSlots)info.slot != (EquipmentSlots)slot)
-            continue;
+uint32 RandomItemMgr::GetOldStatWeight(uint32 specId, uint32 itemId)
+{
+    if (!itemId)
+        return 0;
 
-        // skip higher quality
-        if (quality && info.quality != quality)
-            continue;
+    ItemInfoEntry const* info = FindItemInfo(itemId);
+    if (!info)
+        return 0;
 
-        // skip worse items
-        if (info.weights[specId] <= oldStatWeight)
-            continue;
+    uint32 oldStatWeight = info->GetWeight(specId);
 
-        // skip items that only fit in slot, but not stats
-        if (!itemId && info.weights[specId] == 1 && player->GetLevel() > 40)
-            continue;
+    if (oldStatWeight)
+        LOG_INFO("playerbots", "Old Item: {}, weight: {}", itemId, oldStatWeight);
+    else
+        LOG_INFO("playerbots", "Old item has no stat weight");
 
-        // skip quest items
-        if (info.source == ITEM_SOURCE_QUEST)
-        {
-            if (player->GetQuestRewardStatus(info.sourceId) != QUEST_STATUS_COMPLETE)
-                continue;
-        }
+    return oldStatWeight;
+}
 
-        // skip no stats trinkets
-        if (info.weights[specId] == 1 && info.slot == EQUIPMENT_SLOT_NECK || info.slot == EQUIPMENT_SLOT_TRINKET1 ||
-            info.slot == EQUIPMENT_SLOT_TRINKET2 || info.slot == EQUIPMENT_SLOT_FINGER1 ||
-            info.slot == EQUIPMENT_SLOT_FINGER2)
+template <class Visitor>
+void RandomItemMgr::VisitUpgradeCandidates(uint8 slot, uint32 team, uint32 minLevel, uint32 maxLevel, Visitor visit)
+{
+    for (uint32 listTeam : {team, uint32(TEAM_NEUTRAL)})
+    {
+        auto itr = upgradeIndex.find(std::make_pair(uint32(slot), listTeam));
+        if (itr == upgradeIndex.end())
             continue;
 
-        // check if item stat score is the best among class specs
-        uint32 bestSpecId = 0;
-        uint32 bestSpecScore = 0;
-        for (std::vector<uint32>::iterator i = classspecs.begin(); i != classspecs.end(); ++i)
+        std::vector<uint32> const& list = itr->second;
+        auto entry = std::lower_bound(list.begin(), list.end(), minLevel,
+                                      [this](uint32 i, uint32 level) { return itemInfoCache[i].minLevel < level; });
+        for (; entry != list.end() && itemInfoCache[*entry].minLevel <= maxLevel; ++entry)
         {
-            if (info.weights[*i] > bestSpecScore)
-            {
-                bestSpecId = *i;
-                bestSpecScore = info.weights[specId];
-            }
+            if (!visit(itemInfoCache[*entry]))
+                return;
         }
 
-        if (bestSpecId && bestSpecId != specId && player->GetLevel() > 40)
-            return 0;
+        if (team == TEAM_NEUTRAL)
+            break;
+    }
+}
 
-        if (!closestUpgrade)
-        {
-            closestUpgrade = info.itemId;
-            closestUpgradeWeight = info.weights[specId];
-        }
+uint32 RandomItemMgr::FindUpgrade(Player* player, uint8 level, uint32 team, uint32 specId,
+                                  std::vector<uint32> const& classSpecs, uint8 slot, uint32 quality, uint32 itemId,
+                                  uint32 oldStatWeight)
+{
+    // the lowest level used to be compared unsigned, nothing was found below level 10
+    if (level < 10)
+        return 0;
 
-        // pick closest upgrade
-        if (info.weights[specId] < closestUpgradeWeight)
-        {
-            closestUpgrade = info.itemId;
-            closestUpgradeWeight = info.weights[specId];
-        }
-    }
+    uint32 closestUpgrade = 0;
+    uint32 closestUpgradeWeight = 0;
+    bool wrongSpec = false;
+
+    VisitUpgradeCandidates(slot, team, level - 10, level,
+                           [&](ItemInfoEntry const& info)
+                           {
+                               uint32 weight = info.GetWeight(specId);
+
+                               // skip useless and worse items
+                               if (!weight || weight <= oldStatWeight)
+                                   return true;
+
+                               // skip higher quality
+                               if (quality && info.quality != quality)
+                                   return true;
+
+                               // skip items that only fit in slot, but not stats
+                               if (!itemId && weight == 1 && level > 40)
+                                   return true;
+
+                               // skip quest items, bots without a player have not done any quest
+                               if (info.source == ITEM_SOURCE_QUEST &&
+                                   (!player || player->GetQuestRewardStatus(info.sourceId) != QUEST_STATUS_COMPLETE))
+                                   return true;
+
+                               // skip no stats trinkets
+                               if (weight == 1 && slot == EQUIPMENT_SLOT_NECK || slot == EQUIPMENT_SLOT_TRINKET1 ||
+                                   slot == EQUIPMENT_SLOT_TRINKET2 || slot == EQUIPMENT_SLOT_FINGER1 ||
+                                   slot == EQUIPMENT_SLOT_FINGER2)
+                                   return true;
+
+                               // check if item stat score is the best among class specs
+                               uint32 bestSpecId = 0;
+                               uint32 bestSpecScore = 0;
+                               for (uint32 classSpec : classSpecs)
+                               {
+                                   if (info.GetWeight(classSpec) > bestSpecScore)
+                                   {
+                                       bestSpecId = classSpec;
+                                       bestSpecScore = weight;
+                                   }
+                               }
+
+                               if (bestSpecId && bestSpecId != specId && level > 40)
+                               {
+                                   wrongSpec = true;
+                                   return false;
+                               }
+
+                               // pick closest upgrade, the lowest id among equals as the id ordered scan did
+                               if (!closestUpgrade || weight < closestUpgradeWeight ||
+                                   (weight == closestUpgradeWeight && info.itemId < closestUpgrade))
+                               {
+                                   closestUpgrade = info.itemId;
+                                   closestUpgradeWeight = weight;
+                               }
+
+                               return true;
+                           });
+
+    if (wrongSpec)
+        return 0;
 
-    if (closestUpgrade)
-        LOG_INFO("playerbots", "New Item: {}, weight: {}", closestUpgrade, closestUpgradeWeight);
+    return closestUpgrade;
+}
+
+uint32 RandomItemMgr::GetUpgrade(Player* player, std::string spec, uint8 slot, uint32 quality, uint32 itemId)
+{
+    if (!player)
+        return 0;
+
+    std::vector<uint32> classspecs;
+    uint32 specId = GetSpecId(player->getClass(), spec, classspecs);
+    if (!specId)
+        return 0;
+
+    // get old item statWeight
+    uint32 oldStatWeight = GetOldStatWeight(specId, itemId);
+
+    uint32 closestUpgrade = FindUpgrade(player, player->GetLevel(), player->GetTeamId(), specId, classspecs, slot,
+                                        quality, itemId, oldStatWeight);
+    if (ItemInfoEntry const* info = FindItemInfo(closestUpgrade))
+        LOG_INFO("playerbots", "New Item: {}, weight: {}", closestUpgrade, info->GetWeight(specId));
 
     return closestUpgrade;
 }
@@ -1829,135 +2270,114 @@ std::vector<uint32> RandomItemMgr::GetUpgradeList(Player* player, std::string sp
     if (!player)
         return std::move(listItems);
 
-    // get old item statWeight
-    uint32 oldStatWeight = 0;
-    uint32 specId = 0;
-    uint32 closestUpgrade = 0;
-    uint32 closestUpgradeWeight = 0;
     std::vector<uint32> classspecs;
-
-    for (uint32 specNum = 1; specNum < 5; ++specNum)
-    {
-        if (!m_weightScales[player->getClass()][specNum].info.id)
-            continue;
-
-        classspecs.push_back(m_weightScales[player->getClass()][specNum].info.id);
-
-        if (m_weightScales[player->getClass()][specNum].info.name == spec)
-            specId = m_weightScales[player->getClass()][specNum].info.id;
-    }
-
+    uint32 specId = GetSpecId(player->getClass(), spec, classspecs);
     if (!specId)
         return std::move(listItems);
 
-    if (itemId && itemInfoCache.find(itemId) != itemInfoCache.end())
-    {
-        oldStatWeight = itemInfoCache[itemId].weights[specId];
-
-        if (oldStatWeight)
-            LOG_INFO("playerbots", "Old Item: {}, weight: {}", itemId, oldStatWeight);
-        else
-            LOG_INFO("playerbots", "Old item has no stat weight");
-    }
-
-    for (std::map<uint32, ItemInfoEntry>::iterator i = itemInfoCache.begin(); i != itemInfoCache.end(); ++i)
-    {
-        ItemInfoEntry& info = i->second;
-
-        // skip useless items
-        if (info.weights[specId] == 0)
-            continue;
+    // get old item statWeight
+    uint32 oldStatWeight = GetOldStatWeight(specId, itemId);
+    uint32 closestUpgradeWeight = 0;
+    uint8 level = player->GetLevel();
 
-        // skip higher lvl
-        if (info.minLevel > player->GetLevel())
-            continue;
+    VisitUpgradeCandidates(slot, player->GetTeamId(), level > 20 ? level - 20 : 0, level,
+                           [&](ItemInfoEntry const& info)
+                           {
+                               uint32 weight = info.GetWeight(specId);
 
-        // skip too low level
-        if ((int32)info.minLevel < (int32)(player->GetLevel() - 20))
-            continue;
+                               // skip useless and worse items
+                               if (!weight || weight <= oldStatWeight)
+                                   return true;
 
-        // skip wrong team
-        if (info.team != TEAM_NEUTRAL && info.team != player->GetTeamId())
-            continue;
+                               // skip higher quality
+                               if (quality && info.quality != quality)
+                                   return true;
 
-        // skip wrong slot
-        if ((EquipmentSlots)info.slot != (EquipmentSlots)slot)
-            continue;
+                               // skip items that only fit in slot, but not stats
+                               if (!itemId && weight == 1 && level > 40)
+                                   return true;
 
-        // skip higher quality
-        if (quality && info.quality != quality)
-            continue;
+                               // skip quest items
+                               if (info.source == ITEM_SOURCE_QUEST &&
+                                   player->GetQuestRewardStatus(info.sourceId) != QUEST_STATUS_COMPLETE)
+                                   return true;
 
-        // skip worse items
-        if (info.weights[specId] <= oldStatWeight)
-            continue;
+                               // skip no stats trinkets
+                               if (weight < 2 && (slot == EQUIPMENT_SLOT_NECK || slot == EQUIPMENT_SLOT_TRINKET1 ||
+                                                  slot == EQUIPMENT_SLOT_TRINKET2 || slot == EQUIPMENT_SLOT_FINGER1 ||
+                                                  slot == EQUIPMENT_SLOT_FINGER2))
+                                   return true;
 
-        // skip items that only fit in slot, but not stats
-        if (!itemId && info.weights[specId] == 1 && player->GetLevel() > 40)
-            continue;
+                               listItems.push_back(info.itemId);
+                               closestUpgradeWeight = std::max(closestUpgradeWeight, weight);
+                               return true;
+                           });
 
-        // skip quest items
-        if (info.source == ITEM_SOURCE_QUEST)
-        {
-            if (player->GetQuestRewardStatus(info.sourceId) != QUEST_STATUS_COMPLETE)
-                continue;
-        }
+    // callers got the list ordered by item id before the index
+    std::sort(listItems.begin(), listItems.end());
 
-        // skip no stats trinkets
-        if (info.weights[specId] < 2 && (info.slot == EQUIPMENT_SLOT_NECK || info.slot == EQUIPMENT_SLOT_TRINKET1 ||
-                                         info.slot == EQUIPMENT_SLOT_TRINKET2 || info.slot == EQUIPMENT_SLOT_FINGER1 ||
-                                         info.slot == EQUIPMENT_SLOT_FINGER2))
-            continue;
+    if (listItems.size())
+        LOG_INFO("playerbots", "New Items: {}, Old item:%d, New items max: {}", listItems.size(), oldStatWeight,
+                 closestUpgradeWeight);
 
-        // if (player->GetLevel() >= 40)
-        //{
-        //     // check if item stat score is the best among class specs
-        //     uint32 bestSpecId = 0;
-        //     uint32 bestSpecScore = 0;
-        //     for (vector<uint32>::iterator i = classspecs.begin(); i != classspecs.end(); ++i)
-        //     {
-        //         if (info->weights[*i] > bestSpecScore)
-        //         {
-        //             bestSpecId = *i;
-        //             bestSpecScore = info->weights[specId];
-        //         }
-        //     }
+    return std::move(listItems);
+}
 
-        //    if (bestSpecId && bestSpecId != specId)
-        //        continue;
-        //}
+void RandomItemMgr::BenchmarkUpgrades()
+{
+    uint32 maxLevel = sWorld->getIntConfig(CONFIG_MAX_PLAYER_LEVEL);
+    uint32 queries = 0;
+    uint32 found = 0;
 
-        listItems.push_back(info.itemId);
-        // continue;
+    auto started = std::chrono::steady_clock::now();
+    for (uint8 cls = CLASS_WARRIOR; cls < MAX_CLASSES; ++cls)
+    {
+        std::vector<uint32> classSpecs;
+        GetSpecId(cls, "", classSpecs);
 
-        // pick closest upgrade
-        if (info.weights[specId] > closestUpgradeWeight)
+        for (uint32 specId : classSpecs)
         {
-            closestUpgrade = info.itemId;
-            closestUpgradeWeight = info.weights[specId];
+            for (uint8 slot = EQUIPMENT_SLOT_START; slot < EQUIPMENT_SLOT_END; ++slot)
+            {
+                for (uint32 level = 1; level <= maxLevel; ++level)
+                {
+                    for (uint32 team : {uint32(TEAM_ALLIANCE), uint32(TEAM_HORDE)})
+                    {
+                        if (FindUpgrade(nullptr, level, team, specId, classSpecs, slot, 0, 0, 0))
+                            ++found;
+
+                        ++queries;
+                    }
+                }
+            }
         }
     }
 
-    if (listItems.size())
-        LOG_INFO("playerbots", "New Items: {}, Old item:%d, New items max: {}", listItems.size(), oldStatWeight,
-                 closestUpgradeWeight);
-
-    return std::move(listItems);
+    uint64 elapsed =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - started).count();
+    LOG_INFO("playerbots", "Upgrade benchmark: {} queries, {} upgrades found, {} ms total, {} us per query", queries,
+             found, elapsed / 1000, queries ? elapsed / queries : 0);
 }
 
-bool RandomItemMgr::HasStatWeight(uint32 itemId)
+ItemInfoEntry const* RandomItemMgr::FindItemInfo(uint32 itemId) const
 {
-    auto itr = itemInfoCache.find(itemId);
-    return itr != itemInfoCache.end();
+    auto itr = std::lower_bound(itemInfoCache.begin(), itemInfoCache.end(), itemId,
+                                [](ItemInfoEntry const& info, uint32 id) { return info.itemId < id; });
+    if (itr == itemInfoCache.end() || itr->itemId != itemId)
+        return nullptr;
+
+    return &*itr;
 }
 
+bool RandomItemMgr::HasStatWeight(uint32 itemId) { return FindItemInfo(itemId) != nullptr; }
+
 uint32 RandomItemMgr::GetMinLevelFromCache(uint32 itemId)
 {
-    auto itr = itemInfoCache.find(itemId);
-    if (itr == itemInfoCache.end())
+    ItemInfoEntry const* info = FindItemInfo(itemId);
+    if (!info)
         return 0;
 
-    return itr->second.minLevel;
+    return info->minLevel;
 }
 
 uint32 RandomItemMgr::GetStatWeight(Player* player, uint32 itemId)
@@ -1965,8 +2385,8 @@ uint32 RandomItemMgr::GetStatWeight(Player* player, uint32 itemId)
     if (!player || !itemId)
         return 0;
 
-    auto itr = itemInfoCache.find(itemId);
-    if (itr == itemInfoCache.end())
+    ItemInfoEntry const* info = FindItemInfo(itemId);
+    if (!info)
         return 0;
 
     uint32 statWeight = 0;
@@ -1997,7 +2417,7 @@ uint32 RandomItemMgr::GetStatWeight(Player* player, uint32 itemId)
     if (!specId)
         return 0;
 
-    statWeight = itr->second.weights[specId];
+    statWeight = info->GetWeight(specId);
 
     return statWeight;
 }
@@ -2007,8 +2427,8 @@ uint32 RandomItemMgr::GetLiveStatWeight(Player* player, uint32 itemId)
     if (!player || !itemId)
         return 0;
 
-    auto itr = itemInfoCache.find(itemId);
-    if (itr == itemInfoCache.end())
+    ItemInfoEntry const* info = FindItemInfo(itemId);
+    if (!info)
         return 0;
 
     uint32 statWeight = 0;
@@ -2033,10 +2453,10 @@ uint32 RandomItemMgr::GetLiveStatWeight(Player* player, uint32 itemId)
     if (!specId)
         return 0;
 
-    statWeight = itr->second.weights[specId];
+    statWeight = info->GetWeight(specId);
 
     // skip higher lvl
-    if (itr->second.minLevel > player->GetLevel())
+    if (info->minLevel > player->GetLevel())
         return 0;
 
     // skip too low level
@@ -2044,32 +2464,32 @@ uint32 RandomItemMgr::GetLiveStatWeight(Player* player, uint32 itemId)
     //    return 0;
 
     // skip wrong team
-    if (itr->second.team != TEAM_NEUTRAL && itr->second.team != player->GetTeamId())
+    if (info->team != TEAM_NEUTRAL && info->team != player->GetTeamId())
         return 0;
 
     // skip quest items
-    if (itr->second.source == ITEM_SOURCE_QUEST && itr->second.sourceId)
+    if (info->source == ITEM_SOURCE_QUEST && info->sourceId)
     {
-        if (player->GetQuestRewardStatus(itr->second.sourceId) != QUEST_STATUS_COMPLETE)
+        if (player->GetQuestRewardStatus(info->sourceId) != QUEST_STATUS_COMPLETE)
             return 0;
     }
 
     // skip pvp items
-    if (itr->second.source == ITEM_SOURCE_PVP)
+    if (info->source == ITEM_SOURCE_PVP)
     {
         if (!player->GetHonorPoints() && !player->GetArenaPoints())
             return 0;
     }
 
     // skip no stats trinkets
-    if (itr->second.weights[specId] == 1 &&
-        (itr->second.slot == EQUIPMENT_SLOT_NECK || itr->second.slot == EQUIPMENT_SLOT_TRINKET1 ||
-         itr->second.slot == EQUIPMENT_SLOT_TRINKET2 || itr->second.slot == EQUIPMENT_SLOT_FINGER1 ||
-         itr->second.slot == EQUIPMENT_SLOT_FINGER2))
+    if (statWeight == 1 &&
+        (info->slot == EQUIPMENT_SLOT_NECK || info->slot == EQUIPMENT_SLOT_TRINKET1 ||
+         info->slot == EQUIPMENT_SLOT_TRINKET2 || info->slot == EQUIPMENT_SLOT_FINGER1 ||
+         info->slot == EQUIPMENT_SLOT_FINGER2))
         return 0;
 
     // skip items that only fit in slot, but not stats
-    if (!itemId && itr->second.weights[specId] == 1 && player->GetLevel() > 20)
+    if (!itemId && statWeight == 1 && player->GetLevel() > 20)
         return 0;
 
     // check if item stat score is the best among class specs
@@ -6,6 +6,7 @@
 #ifndef _PLAYERBOT_RANDOMITEMMGR_H
 #define _PLAYERBOT_RANDOMITEMMGR_H
 
+#include <array>
 #include <map>
 #include <set>
 #include <unordered_set>
@@ -31,6 +32,9 @@ enum RandomItemType
 };
 
 #define MAX_STAT_SCALES 32
+#define RANDOM_ITEM_SNAPSHOT_MAGIC 0x43494250  // PBIC
+// raise whenever the caches in the snapshot or the way they are built change
+#define RANDOM_ITEM_SNAPSHOT_VERSION 1
 
 enum ItemSource
 {
@@ -65,13 +69,12 @@ struct ItemInfoEntry
     ItemInfoEntry()
         : minLevel(0), source(0), sourceId(0), team(0), repRank(0), repFaction(0), quality(0), slot(0), itemId(0)
     {
-        for (uint8 i = 1; i <= MAX_STAT_SCALES; ++i)
-        {
-            weights[i] = 0;
-        }
+        weights.fill(0);
     }
 
-    std::map<uint32, uint32> weights;
+    uint32 GetWeight(uint32 specId) const { return specId <= MAX_STAT_SCALES ? weights[specId] : 0; }
+
+    std::array<uint32, MAX_STAT_SCALES + 1> weights;
     uint32 minLevel;
     uint32 source;
     uint32 sourceId;
@@ -172,6 +175,8 @@ public:
     uint32 GetQuestIdForItem(uint32 itemId);
     std::vector<uint32> GetQuestIdsForItem(uint32 itemId);
     static bool IsUsedBySkill(ItemTemplate const* proto, uint32 skillId);
+    // times GetUpgrade for every class, spec, slot, level and team and logs the result
+    void BenchmarkUpgrades();
     bool IsTestItem(uint32 itemId) { return itemForTest.find(itemId) != itemForTest.end(); }
     std::vector<uint32> GetCachedEquipments(uint32 requiredLevel, uint32 inventoryType);
 
@@ -179,7 +184,9 @@ private:
     void BuildRandomItemCache();
     void BuildEquipCache();
     void BuildEquipCacheNew();
+    void LoadWeightScales();
     void BuildItemInfoCache();
+    void BuildItemUpgradeIndex();
     void BuildAmmoCache();
     void BuildFoodCache();
     void BuildPotionCache();
@@ -188,7 +195,18 @@ private:
     bool CanEquipItem(BotEquipKey key, ItemTemplate const* proto);
     bool CanEquipItemNew(ItemTemplate const* proto);
     void AddItemStats(uint32 mod, uint8& sp, uint8& ap, uint8& tank);
+    uint32 GetSpecId(uint8 cls, std::string const spec, std::vector<uint32>& classSpecs);
+    uint32 GetOldStatWeight(uint32 specId, uint32 itemId);
+    ItemInfoEntry const* FindItemInfo(uint32 itemId) const;
+    template <class Visitor>
+    void VisitUpgradeCandidates(uint8 slot, uint32 team, uint32 minLevel, uint32 maxLevel, Visitor visit);
+    uint32 FindUpgrade(Player* player, uint8 level, uint32 team, uint32 specId, std::vector<uint32> const& classSpecs,
+                       uint8 slot, uint32 quality, uint32 itemId, uint32 oldStatWeight);
     bool CheckItemStats(uint8 clazz, uint8 sp, uint8 ap, uint8 tank);
+    std::string GetCacheSnapshotPath();
+    uint64 GetCacheSnapshotKey();
+    bool LoadCacheSnapshot(std::string const& path, uint64 key);
+    void SaveCacheSnapshot(std::string const& path, uint64 key);
 
 private:
     std::map<uint32, RandomItemCache> randomItemCache;
@@ -203,7 +221,10 @@ private:
     std::map<uint8, WeightScale> m_weightScales[MAX_CLASSES];
     std::map<std::string, uint32> weightStatLink;
     std::map<std::string, uint32> weightRatingLink;
-    std::map<uint32, ItemInfoEntry> itemInfoCache;
+    // sorted by itemId, see FindItemInfo
+    std::vector<ItemInfoEntry> itemInfoCache;
+    // positions in itemInfoCache by slot and team, sorted by minLevel
+    std::map<std::pair<uint32, uint32>, std::vector<uint32>> upgradeIndex;
     std::unordered_set<uint32> itemForTest;
     static std::set<uint32> itemCache;
     // equipCacheNew[RequiredLevel][InventoryType]
@@ -10,6 +10,7 @@
 #include <cstdlib>
 #include <iomanip>
 #include <random>
+#include <unordered_set>
 
 #include "AccountMgr.h"
 #include "AiFactory.h"
@@ -17,7 +18,7 @@
 #include "Battleground.h"
 #include "BattlegroundMgr.h"
 #include "CellImpl.h"
-#include "ChannelMgr.h"
+#include "Channel.h"
 #include "DatabaseEnv.h"
 #include "Define.h"
 #include "FleeManager.h"
@@ -31,8 +32,10 @@
 #include "PerformanceMonitor.h"
 #include "PlayerbotAI.h"
 #include "PlayerbotAIConfig.h"
+#include "PlayerbotChatMessage.h"
 #include "PlayerbotCommandServer.h"
 #include "PlayerbotFactory.h"
+#include "PlayerbotTaskScheduler.h"
 #include "Playerbots.h"
 #include "Random.h"
 #include "ServerFacade.h"
@@ -41,6 +44,13 @@
 #include "UpdateTime.h"
 #include "World.h"
 
+// most rows written by one statement of FlushEvents
+#define RANDOM_BOT_EVENT_FLUSH_ROWS 500
+// the population report is written once no bot was logged in for this long
+#define POPULATION_LOGIN_IDLE_TIME (30 * IN_MILLISECONDS)
+// or at the latest after this long
+#define POPULATION_REPORT_TIMEOUT (HOUR * IN_MILLISECONDS)
+
 void PrintStatsThread() { sRandomPlayerbotMgr->PrintStats(); }
 
 void activatePrintStatsThread()
@@ -49,30 +59,6 @@ void activatePrintStatsThread()
     t.detach();
 }
 
-void CheckBgQueueThread() { sRandomPlayerbotMgr->CheckBgQueue(); }
-
-void activateCheckBgQueueThread()
-{
-    boost::thread t(CheckBgQueueThread);
-    t.detach();
-}
-
-void CheckLfgQueueThread() { sRandomPlayerbotMgr->CheckLfgQueue(); }
-
-void activateCheckLfgQueueThread()
-{
-    boost::thread t(CheckLfgQueueThread);
-    t.detach();
-}
-
-void CheckPlayersThread() { sRandomPlayerbotMgr->CheckPlayers(); }
-
-void activateCheckPlayersThread()
-{
-    boost::thread t(CheckPlayersThread);
-    t.detach();
-}
-
 class botPIDImpl
 {
 public:
@@ -85,6 +71,11 @@ public:
         _Ki = Ki;
         _Kd = Kd;
     }
+    void setLimits(double max, double min)
+    {
+        _max = max;
+        _min = min;
+    }
     void reset() { _integral = 0; }
 
 private:
@@ -103,6 +94,7 @@ botPID::botPID(double dt, double max, double min, double Kp, double Ki, double K
     pimpl = new botPIDImpl(dt, max, min, Kp, Ki, Kd);
 }
 void botPID::adjust(double Kp, double Ki, double Kd) { pimpl->adjust(Kp, Ki, Kd); }
+void botPID::setLimits(double max, double min) { pimpl->setLimits(max, min); }
 void botPID::reset() { pimpl->reset(); }
 double botPID::calculate(double setpoint, double pv) { return pimpl->calculate(setpoint, pv); }
 botPID::~botPID() { delete pimpl; }
@@ -154,7 +146,20 @@ double botPIDImpl::calculate(double setpoint, double pv)
 
 botPIDImpl::~botPIDImpl() {}
 
-RandomPlayerbotMgr::RandomPlayerbotMgr() : PlayerbotHolder(), processTicks(0)
+RandomPlayerbotMgr::RandomPlayerbotMgr()
+    : PlayerbotHolder(),
+      processTicks(0),
+      eventsLoaded(false),
+      eventsFlushTime(0),
+      botCharactersLoading(false),
+      botCharactersLoaded(false),
+      populationStartTime(0),
+      populationLoginTime(0),
+      populationReported(false),
+      populationUpdateTimes(),
+      populationUpdates(0),
+      populationMaxUpdateTime(0),
+      checkedPlayersLevel(0)
 {
     playersLevel = sPlayerbotAIConfig->randombotStartingLevel;
 
@@ -173,7 +178,7 @@ RandomPlayerbotMgr::RandomPlayerbotMgr() : PlayerbotHolder(), processTicks(0)
 
 RandomPlayerbotMgr::~RandomPlayerbotMgr() {}
 
-uint32 RandomPlayerbotMgr::GetMaxAllowedBotCount() { return GetEventValue(0, "bot_count"); }
+uint32 RandomPlayerbotMgr::GetMaxAllowedBotCount() { return GetEventValue(0, RANDOM_BOT_EVENT_BOT_COUNT); }
 
 void RandomPlayerbotMgr::LogPlayerLocation()
 {
@@ -289,6 +294,12 @@ void RandomPlayerbotMgr::UpdateAIInternal(uint32 elapsed, bool /*minimal*/)
 
     totalPmo = sPerformanceMonitor->start(PERF_MON_TOTAL, "RandomPlayerbotMgr::FullTick");
 
+    queryProcessor.ProcessReadyCallbacks();
+    ApplyQueueChecks();
+
+    if (time(nullptr) >= eventsFlushTime)
+        FlushEvents();
+
     if (!sPlayerbotAIConfig->randomBotAutologin || !sPlayerbotAIConfig->enabled)
         return;
 
@@ -297,12 +308,12 @@ void RandomPlayerbotMgr::UpdateAIInternal(uint32 elapsed, bool /*minimal*/)
         ScaleBotActivity();
     }
 
-    uint32 maxAllowedBotCount = GetEventValue(0, "bot_count");
+    uint32 maxAllowedBotCount = GetEventValue(0, RANDOM_BOT_EVENT_BOT_COUNT);
     if (!maxAllowedBotCount || (maxAllowedBotCount < sPlayerbotAIConfig->minRandomBots ||
                                 maxAllowedBotCount > sPlayerbotAIConfig->maxRandomBots))
     {
         maxAllowedBotCount = urand(sPlayerbotAIConfig->minRandomBots, sPlayerbotAIConfig->maxRandomBots);
-        SetEventValue(0, "bot_count", maxAllowedBotCount,
+        SetEventValue(0, RANDOM_BOT_EVENT_BOT_COUNT, maxAllowedBotCount,
                       urand(sPlayerbotAIConfig->randomBotCountChangeMinInterval,
                             sPlayerbotAIConfig->randomBotCountChangeMaxInterval));
     }
@@ -333,23 +344,25 @@ void RandomPlayerbotMgr::UpdateAIInternal(uint32 elapsed, bool /*minimal*/)
     if (sPlayerbotAIConfig->syncLevelWithPlayers && !players.empty())
     {
         if (time(nullptr) > (PlayersCheckTimer + 60))
-            activateCheckPlayersThread();
+            CheckPlayers();
     }
 
     if (sPlayerbotAIConfig->randomBotJoinBG /* && !players.empty()*/)
     {
         if (time(nullptr) > (BgCheckTimer + 30))
-            activateCheckBgQueueThread();
+            CheckBgQueue();
     }
 
     if (sPlayerbotAIConfig->randomBotJoinLfg /* && !players.empty()*/)
     {
         if (time(nullptr) > (LfgCheckTimer + 30))
-            activateCheckLfgQueueThread();
+            CheckLfgQueue();
     }
 
     uint32 updateBots = sPlayerbotAIConfig->randomBotsPerInterval * onlineBotFocus / 100;
-    uint32 maxNewBots = onlineBotCount < maxAllowedBotCount ? maxAllowedBotCount - onlineBotCount : 0;
+    uint32 maxNewBots = onlineBotCount + botLoading.size() < maxAllowedBotCount
+                            ? maxAllowedBotCount - onlineBotCount - botLoading.size()
+                            : 0;
     uint32 loginBots = std::min(sPlayerbotAIConfig->randomBotsPerInterval - updateBots, maxNewBots);
 
     if (!availableBots.empty())
@@ -369,13 +382,17 @@ void RandomPlayerbotMgr::UpdateAIInternal(uint32 elapsed, bool /*minimal*/)
                 break;
         }
 
-        if (loginBots && botLoading.empty())
+        // the next batch is loaded from the database while the previous one is still added to the world
+        if (loginBots && botLoading.size() == loginQueue.size())
         {
             loginBots += updateBots;
             loginBots = std::min(loginBots, maxNewBots);
 
             LOG_INFO("playerbots", "{} new bots", loginBots);
 
+            if (!populationStartTime && !populationReported)
+                populationStartTime = getMSTime();
+
             // Log in bots
             for (auto bot : availableBots)
             {
@@ -402,6 +419,63 @@ void RandomPlayerbotMgr::UpdateAIInternal(uint32 elapsed, bool /*minimal*/)
     }
 }
 
+uint32 RandomPlayerbotMgr::GetLoginTimeBudget()
+{
+    if (!sPlayerbotAIConfig->botLoginTargetUpdateTime)
+        return 0;
+
+    // the integral stops growing at the configured budget, so a lower update time does not build up a backlog
+    loginPid.setLimits(std::max<uint32>(1, sPlayerbotAIConfig->botLoginMaxTimeBudget), 1);
+    double budget = loginPid.calculate(sPlayerbotAIConfig->botLoginTargetUpdateTime,
+                                       sWorldUpdateTime.GetAverageUpdateTime());
+
+    // the next batch starts from the current update time instead of the past one
+    if (loginQueue.size() <= 1)
+        loginPid.reset();
+
+    return uint32(budget);
+}
+
+void RandomPlayerbotMgr::UpdatePopulationStats()
+{
+    if (!populationStartTime || populationReported)
+        return;
+
+    uint32 updateTime = sWorldUpdateTime.GetLastUpdateTime();
+    ++populationUpdateTimes[std::min<uint32>(updateTime, POPULATION_UPDATE_BUCKETS - 1)];
+    ++populationUpdates;
+    populationMaxUpdateTime = std::max(populationMaxUpdateTime, updateTime);
+
+    if (!loginQueue.empty() || !botLoading.empty())
+        populationLoginTime = getMSTime();
+
+    // the bot count may never be reached, e.g. when there are fewer bot characters than allowed bots
+    uint32 maxAllowedBotCount = GetMaxAllowedBotCount();
+    bool complete = maxAllowedBotCount && playerBots.size() >= maxAllowedBotCount;
+    bool drained = populationLoginTime && GetMSTimeDiffToNow(populationLoginTime) >= POPULATION_LOGIN_IDLE_TIME;
+    if (!complete && !drained && GetMSTimeDiffToNow(populationStartTime) < POPULATION_REPORT_TIMEOUT)
+        return;
+
+    auto percentile = [this](uint32 p)
+    {
+        uint32 rank = (populationUpdates - 1) * p / 100;
+        uint32 bucket = 0;
+        for (uint32 count = populationUpdateTimes[0]; count <= rank; count += populationUpdateTimes[bucket])
+            ++bucket;
+
+        return bucket;
+    };
+
+    LOG_INFO("playerbots",
+             ">> {} random bots online in {} s{}, world update p50 {} ms, p95 {} ms, p99 {} ms, max {} ms over {} "
+             "updates",
+             playerBots.size(), GetMSTimeDiffToNow(populationStartTime) / IN_MILLISECONDS,
+             complete ? "" : " (population incomplete)", percentile(50), percentile(95), percentile(99),
+             populationMaxUpdateTime, populationUpdates);
+
+    populationReported = true;
+}
+
 void RandomPlayerbotMgr::ScaleBotActivity()
 {
     float activityPercentage = getActivityPercentage();
@@ -425,13 +499,23 @@ void RandomPlayerbotMgr::ScaleBotActivity()
 
 uint32 RandomPlayerbotMgr::AddRandomBots()
 {
-    uint32 maxAllowedBotCount = GetEventValue(0, "bot_count");
+    // bots are picked from the character catalog, no bot is added before it arrived
+    if (!botCharactersLoaded)
+    {
+        LoadBotCharacters();
+        return currentBots.size();
+    }
+
+    uint32 maxAllowedBotCount = GetEventValue(0, RANDOM_BOT_EVENT_BOT_COUNT);
 
     if (currentBots.size() < maxAllowedBotCount)
     {
         maxAllowedBotCount -= currentBots.size();
         maxAllowedBotCount = std::min(sPlayerbotAIConfig->randomBotsPerInterval, maxAllowedBotCount);
 
+        // the bots already added, looked up for every candidate
+        std::unordered_set<uint32> addedBots(currentBots.begin(), currentBots.end());
+
         for (std::vector<uint32>::iterator i = sPlayerbotAIConfig->randomBotAccounts.begin();
              i != sPlayerbotAIConfig->randomBotAccounts.end(); i++)
         {
@@ -443,45 +527,30 @@ uint32 RandomPlayerbotMgr::AddRandomBots()
                 uint32 index = urand(0, limit);
                 accountId = sPlayerbotAIConfig->randomBotAccounts[index];
             }
-            CharacterDatabasePreparedStatement* stmt =
-                CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARS_BY_ACCOUNT_ID);
-            stmt->SetData(0, accountId);
-            PreparedQueryResult result = CharacterDatabase.Query(stmt);
-            if (!result)
+            auto characters = botCharacters.find(accountId);
+            if (characters == botCharacters.end())
                 continue;
             std::vector<uint32> guids;
-            do
+            for (RandomBotCharacter const& character : characters->second)
             {
-                Field* fields = result->Fetch();
-                ObjectGuid::LowType guid = fields[0].Get<uint32>();
-                if (GetEventValue(guid, "add"))
+                ObjectGuid::LowType guid = character.guid;
+                if (GetEventValue(guid, RANDOM_BOT_EVENT_ADD))
                     continue;
 
-                if (GetEventValue(guid, "logout"))
+                if (GetEventValue(guid, RANDOM_BOT_EVENT_LOGOUT))
                     continue;
 
                 if (GetPlayerBot(guid))
                     continue;
 
-                if (std::find(currentBots.begin(), currentBots.end(), guid) != currentBots.end())
+                if (addedBots.count(guid))
+                    continue;
+
+                if (sPlayerbotAIConfig->disableDeathKnightLogin && character.cls == CLASS_DEATH_KNIGHT)
                     continue;
 
-                if (sPlayerbotAIConfig->disableDeathKnightLogin)
-                {
-                    QueryResult result = CharacterDatabase.Query("Select class from characters where guid = {}", guid);
-                    if (!result)
-                    {
-                        continue;
-                    }
-                    Field* fields = result->Fetch();
-                    uint32 rClass = fields[0].Get<uint32>();
-                    if (rClass == CLASS_DEATH_KNIGHT)
-                    {
-                        continue;
-                    }
-                }
                 guids.push_back(guid);
-            } while (result->NextRow());
+            }
 
             std::mt19937 rnd(time(0));
             std::shuffle(guids.begin(), guids.end(), rnd);
@@ -493,9 +562,10 @@ uint32 RandomPlayerbotMgr::AddRandomBots()
                                               sPlayerbotAIConfig->maxRandomBotInWorldTime)
                                       : sPlayerbotAIConfig->randomBotInWorldWithRotationDisabled;
 
-                SetEventValue(guid, "add", 1, add_time);
-                SetEventValue(guid, "logout", 0, 0);
+                SetEventValue(guid, RANDOM_BOT_EVENT_ADD, 1, add_time);
+                SetEventValue(guid, RANDOM_BOT_EVENT_LOGOUT, 0, 0);
                 currentBots.push_back(guid);
+                addedBots.insert(guid);
 
                 maxAllowedBotCount--;
                 if (!maxAllowedBotCount)
@@ -514,6 +584,90 @@ uint32 RandomPlayerbotMgr::AddRandomBots()
     return currentBots.size();
 }
 
+void RandomPlayerbotMgr::LoadBotCharacters()
+{
+    if (botCharactersLoading || sPlayerbotAIConfig->randomBotAccounts.empty())
+        return;
+
+    botCharactersLoading = true;
+
+    std::ostringstream accounts;
+    for (std::vector<uint32>::iterator i = sPlayerbotAIConfig->randomBotAccounts.begin();
+         i != sPlayerbotAIConfig->randomBotAccounts.end(); ++i)
+        accounts << (i == sPlayerbotAIConfig->randomBotAccounts.begin() ? "" : ", ") << *i;
+
+    std::string const query =
+        "SELECT guid, account, class, level FROM characters WHERE account IN (" + accounts.str() + ")";
+    uint32 oldMSTime = getMSTime();
+
+    auto loaded = [this, oldMSTime](QueryResult result)
+    {
+        botCharacters.clear();
+
+        uint32 count = 0;
+        if (result)
+        {
+            do
+            {
+                Field* fields = result->Fetch();
+                RandomBotCharacter character;
+                character.guid = fields[0].Get<uint32>();
+                character.cls = fields[2].Get<uint8>();
+                character.level = fields[3].Get<uint8>();
+                botCharacters[fields[1].Get<uint32>()].push_back(character);
+                ++count;
+            } while (result->NextRow());
+        }
+
+        botCharactersLoading = false;
+        botCharactersLoaded = true;
+        LOG_INFO("playerbots", ">> Loaded {} random bot characters in {} ms", count, GetMSTimeDiffToNow(oldMSTime));
+    };
+
+    queryProcessor.AddCallback(CharacterDatabase.AsyncQuery(query).WithCallback(std::move(loaded)));
+}
+
+void RandomPlayerbotMgr::OnBotCharacterCreate(Player* player)
+{
+    uint32 accountId = player->GetSession()->GetAccountId();
+    if (!botCharactersLoaded || !sPlayerbotAIConfig->IsInRandomAccountList(accountId))
+        return;
+
+    RandomBotCharacter character;
+    character.guid = player->GetGUID().GetCounter();
+    character.cls = player->getClass();
+    character.level = player->GetLevel();
+    botCharacters[accountId].push_back(character);
+}
+
+void RandomPlayerbotMgr::OnBotCharacterDelete(uint32 guid)
+{
+    for (auto& [accountId, characters] : botCharacters)
+    {
+        for (auto itr = characters.begin(); itr != characters.end(); ++itr)
+        {
+            if (itr->guid == guid)
+            {
+                characters.erase(itr);
+                return;
+            }
+        }
+    }
+}
+
+void RandomPlayerbotMgr::OnBotCharacterLevelChanged(Player* player)
+{
+    auto characters = botCharacters.find(player->GetSession()->GetAccountId());
+    if (characters == botCharacters.end())
+        return;
+
+    for (RandomBotCharacter& character : characters->second)
+    {
+        if (character.guid == player->GetGUID().GetCounter())
+            character.level = player->GetLevel();
+    }
+}
+
 void RandomPlayerbotMgr::LoadBattleMastersCache()
 {
     BattleMastersCache.clear();
@@ -573,215 +727,201 @@ void RandomPlayerbotMgr::LoadBattleMastersCache()
     LOG_INFO("playerbots", ">> Loaded {} battlemaster entries", count);
 }
 
-void RandomPlayerbotMgr::CheckBgQueue()
+// copies the battleground queue slots of a player or random bot, CheckBgQueue counts them on the task scheduler
+static void AddBattlegroundQueueEntries(Player* player, bool isBot, std::vector<BattlegroundQueueEntry>& entries)
 {
-    if (!BgCheckTimer)
-        BgCheckTimer = time(nullptr);
-
-    if (time(nullptr) < BgCheckTimer + 30)
+    if (!player->InBattlegroundQueue())
         return;
 
-    BgCheckTimer = time(nullptr);
-
-    LOG_INFO("playerbots", "Checking BG Queue...");
-
-    BattlegroundData.clear();
+    Battleground* bg = player->GetBattleground();
+    if (bg && bg->GetStatus() == STATUS_WAIT_LEAVE)
+        return;
 
-    for (Player* player : players)
+    for (uint8 queueType = 0; queueType < PLAYER_MAX_BATTLEGROUND_QUEUES; ++queueType)
     {
-        if (!player->InBattlegroundQueue())
+        BattlegroundQueueTypeId queueTypeId = player->GetBattlegroundQueueTypeId(queueType);
+        if (queueTypeId == BATTLEGROUND_QUEUE_NONE)
             continue;
 
-        Battleground* bg = player->GetBattleground();
-        if (bg && bg->GetStatus() == STATUS_WAIT_LEAVE)
+        BattlegroundTypeId bgTypeId = sBattlegroundMgr->BGTemplateId(queueTypeId);
+        Battleground* bgTemplate = sBattlegroundMgr->GetBattlegroundTemplate(bgTypeId);
+        PvPDifficultyEntry const* pvpDiff = GetBattlegroundBracketByLevel(bgTemplate->GetMapId(), player->GetLevel());
+        if (!pvpDiff)
             continue;
 
-        TeamId teamId = player->GetTeamId();
-        for (uint8 queueType = 0; queueType < PLAYER_MAX_BATTLEGROUND_QUEUES; ++queueType)
+        BattlegroundQueueEntry entry;
+        entry.queueTypeId = queueTypeId;
+        entry.bracketId = pvpDiff->GetBracketId();
+        entry.minLevel = pvpDiff->minLevel;
+        entry.maxLevel = pvpDiff->maxLevel;
+        entry.teamId = player->GetTeamId();
+        entry.isBot = isBot;
+        entry.isArena = BattlegroundMgr::BGArenaType(queueTypeId) != 0;
+        entry.inArena = player->InArena();
+        entry.inRatedArena = entry.inArena && bg->isRated();
+        entry.isRated = false;
+        entry.isWaiting = !player->IsInvitedForBattlegroundInstance() && !player->InBattleground();
+        entry.instanceId = player->InBattleground() ? bg->GetInstanceID() : 0;
+
+        if (entry.isArena)
         {
-            BattlegroundQueueTypeId queueTypeId = player->GetBattlegroundQueueTypeId(queueType);
-            if (queueTypeId == BATTLEGROUND_QUEUE_NONE)
-                continue;
-
-            BattlegroundTypeId bgTypeId = sBattlegroundMgr->BGTemplateId(queueTypeId);
-            bg = sBattlegroundMgr->GetBattlegroundTemplate(bgTypeId);
-            uint32 mapId = bg->GetMapId();
-            PvPDifficultyEntry const* pvpDiff = GetBattlegroundBracketByLevel(mapId, player->GetLevel());
-            if (!pvpDiff)
-                continue;
-
-            BattlegroundBracketId bracketId = pvpDiff->GetBracketId();
-
-            BattlegroundData[queueTypeId][bracketId].minLevel = pvpDiff->minLevel;
-            BattlegroundData[queueTypeId][bracketId].maxLevel = pvpDiff->maxLevel;
+            BattlegroundQueue& bgQueue = sBattlegroundMgr->GetBattlegroundQueue(queueTypeId);
+            GroupQueueInfo ginfo;
 
-            bool isRated = false;
-            if (uint8 arenaType = BattlegroundMgr::BGArenaType(queueTypeId))
+            if (bgQueue.GetPlayerGroupInfoData(player->GetGUID(), &ginfo))
             {
-                BattlegroundQueue& bgQueue = sBattlegroundMgr->GetBattlegroundQueue(queueTypeId);
-                GroupQueueInfo ginfo;
+                if (ginfo.IsRated)
+                    entry.isRated = true;
+            }
 
-                if (bgQueue.GetPlayerGroupInfoData(player->GetGUID(), &ginfo))
-                {
-                    if (ginfo.IsRated)
-                        isRated = true;
-                }
+            if (bgQueue.IsPlayerInvitedToRatedArena(player->GetGUID()) || entry.inRatedArena)
+                entry.isRated = true;
+        }
 
-                if (bgQueue.IsPlayerInvitedToRatedArena(player->GetGUID()) ||
-                    (player->InArena() && player->GetBattleground()->isRated()))
-                    isRated = true;
+        entries.push_back(entry);
+    }
+}
 
-                if (isRated)
-                    BattlegroundData[queueTypeId][bracketId].ratedArenaPlayerCount++;
-                else
-                    BattlegroundData[queueTypeId][bracketId].skirmishArenaPlayerCount++;
-            }
+static void CountBattlegroundPlayers(BattlegroundInfoMap& data, std::vector<BattlegroundQueueEntry> const& players)
+{
+    for (BattlegroundQueueEntry const& entry : players)
+    {
+        BattlegroundInfo& info = data[entry.queueTypeId][entry.bracketId];
+        info.minLevel = entry.minLevel;
+        info.maxLevel = entry.maxLevel;
+
+        if (entry.isArena)
+        {
+            if (entry.isRated)
+                info.ratedArenaPlayerCount++;
+            else
+                info.skirmishArenaPlayerCount++;
+        }
+        else if (entry.isBot)
+        {
+            if (entry.teamId == TEAM_ALLIANCE)
+                info.bgAllianceBotCount++;
             else
+                info.bgHordeBotCount++;
+        }
+        else
+        {
+            if (entry.teamId == TEAM_ALLIANCE)
+                info.bgAlliancePlayerCount++;
+            else
+                info.bgHordePlayerCount++;
+        }
+
+        if (entry.isWaiting)
+        {
+            if (entry.isArena)
             {
-                if (GET_PLAYERBOT_AI(player))
-                {
-                    if (teamId == TEAM_ALLIANCE)
-                        BattlegroundData[queueTypeId][bracketId].bgAllianceBotCount++;
-                    else
-                        BattlegroundData[queueTypeId][bracketId].bgHordeBotCount++;
-                }
+                if (entry.isRated)
+                    info.activeRatedArenaQueue = 1;
                 else
-                {
-                    if (teamId == TEAM_ALLIANCE)
-                        BattlegroundData[queueTypeId][bracketId].bgAlliancePlayerCount++;
-                    else
-                        BattlegroundData[queueTypeId][bracketId].bgHordePlayerCount++;
-                }
+                    info.activeSkirmishArenaQueue = 1;
             }
-
-            if (!player->IsInvitedForBattlegroundInstance() && !player->InBattleground())
+            else
             {
-                if (BattlegroundMgr::BGArenaType(queueTypeId))
-                {
-                    if (isRated)
-                        BattlegroundData[queueTypeId][bracketId].activeRatedArenaQueue = 1;
-                    else
-                        BattlegroundData[queueTypeId][bracketId].activeSkirmishArenaQueue = 1;
-                }
-                else
-                {
-                    BattlegroundData[queueTypeId][bracketId].activeBgQueue = 1;
-                }
+                info.activeBgQueue = 1;
             }
         }
     }
+}
 
-    for (PlayerBotMap::iterator i = playerBots.begin(); i != playerBots.end(); ++i)
+static void CountBattlegroundBots(BattlegroundInfoMap& data, std::vector<BattlegroundQueueEntry> const& bots)
+{
+    for (BattlegroundQueueEntry const& entry : bots)
     {
-        Player* bot = i->second;
-        if (!bot || !bot->IsInWorld())
-            continue;
+        BattlegroundInfo& info = data[entry.queueTypeId][entry.bracketId];
+        info.minLevel = entry.minLevel;
+        info.maxLevel = entry.maxLevel;
 
-        if (!bot->InBattlegroundQueue())
-            continue;
+        if (entry.isArena)
+        {
+            if (entry.isRated)
+                info.ratedArenaBotCount++;
+            else
+                info.skirmishArenaBotCount++;
+        }
+        else
+        {
+            if (entry.teamId == TEAM_ALLIANCE)
+                info.bgAllianceBotCount++;
+            else
+                info.bgHordeBotCount++;
+        }
 
-        if (!IsRandomBot(bot))
+        if (!entry.instanceId)
             continue;
 
-        Battleground* bg = bot->GetBattleground();
-        if (bg && bg->GetStatus() == STATUS_WAIT_LEAVE)
-            continue;
+        std::vector<uint32>* instanceIds = &info.bgInstances;
+        if (entry.inArena)
+            instanceIds = entry.inRatedArena ? &info.ratedArenaInstances : &info.skirmishArenaInstances;
 
-        TeamId teamId = bot->GetTeamId();
+        if (std::find(instanceIds->begin(), instanceIds->end(), entry.instanceId) == instanceIds->end())
+            instanceIds->push_back(entry.instanceId);
 
-        for (uint8 queueType = 0; queueType < PLAYER_MAX_BATTLEGROUND_QUEUES; ++queueType)
+        if (entry.inArena)
         {
-            BattlegroundQueueTypeId queueTypeId = bot->GetBattlegroundQueueTypeId(queueType);
-            if (queueTypeId == BATTLEGROUND_QUEUE_NONE)
-                continue;
+            if (entry.inRatedArena)
+                info.ratedArenaInstanceCount = instanceIds->size();
+            else
+                info.skirmishArenaInstanceCount = instanceIds->size();
+        }
+        else
+        {
+            info.bgInstanceCount = instanceIds->size();
+        }
+    }
+}
 
-            BattlegroundTypeId bgTypeId = sBattlegroundMgr->BGTemplateId(queueTypeId);
-            bg = sBattlegroundMgr->GetBattlegroundTemplate(bgTypeId);
-            uint32 mapId = bg->GetMapId();
-            PvPDifficultyEntry const* pvpDiff = GetBattlegroundBracketByLevel(mapId, bot->GetLevel());
-            if (!pvpDiff)
-                continue;
+void RandomPlayerbotMgr::CheckBgQueue()
+{
+    if (!BgCheckTimer)
+        BgCheckTimer = time(nullptr);
 
-            BattlegroundBracketId bracketId = pvpDiff->GetBracketId();
+    if (time(nullptr) < BgCheckTimer + 30)
+        return;
 
-            BattlegroundData[queueTypeId][bracketId].minLevel = pvpDiff->minLevel;
-            BattlegroundData[queueTypeId][bracketId].maxLevel = pvpDiff->maxLevel;
+    BgCheckTimer = time(nullptr);
 
-            if (uint8 arenaType = BattlegroundMgr::BGArenaType(queueTypeId))
-            {
-                bool isRated = false;
-                BattlegroundQueue& bgQueue = sBattlegroundMgr->GetBattlegroundQueue(queueTypeId);
-                GroupQueueInfo ginfo;
+    LOG_INFO("playerbots", "Checking BG Queue...");
 
-                if (bgQueue.GetPlayerGroupInfoData(bot->GetGUID(), &ginfo))
-                {
-                    if (ginfo.IsRated)
-                        isRated = true;
-                }
+    // queues and players only change on the world and map threads, so they are copied here and counted later
+    std::shared_ptr<BattlegroundQueueSnapshot> snapshot = std::make_shared<BattlegroundQueueSnapshot>();
 
-                if (bgQueue.IsPlayerInvitedToRatedArena(bot->GetGUID()) ||
-                    (bot->InArena() && bot->GetBattleground()->isRated()))
-                    isRated = true;
+    for (Player* player : players)
+        AddBattlegroundQueueEntries(player, GET_PLAYERBOT_AI(player) != nullptr, snapshot->players);
 
-                if (isRated)
-                    BattlegroundData[queueTypeId][bracketId].ratedArenaBotCount++;
-                else
-                    BattlegroundData[queueTypeId][bracketId].skirmishArenaBotCount++;
-            }
-            else
-            {
-                if (teamId == TEAM_ALLIANCE)
-                    BattlegroundData[queueTypeId][bracketId].bgAllianceBotCount++;
-                else
-                    BattlegroundData[queueTypeId][bracketId].bgHordeBotCount++;
-            }
+    for (PlayerBotMap::iterator i = playerBots.begin(); i != playerBots.end(); ++i)
+    {
+        Player* bot = i->second;
+        if (!bot || !bot->IsInWorld())
+            continue;
 
-            if (bot->InBattleground())
-            {
-                std::vector<uint32>* instanceIds = nullptr;
-                uint32 instanceId = bot->GetBattleground()->GetInstanceID();
-                bool isArena = false;
-                bool isRated = false;
+        if (!IsRandomBot(bot))
+            continue;
 
-                if (bot->InArena())
-                {
-                    isArena = true;
-                    if (bot->GetBattleground()->isRated())
-                    {
-                        isRated = true;
-                        instanceIds = &BattlegroundData[queueTypeId][bracketId].ratedArenaInstances;
-                    }
-                    else
-                    {
-                        instanceIds = &BattlegroundData[queueTypeId][bracketId].skirmishArenaInstances;
-                    }
-                }
-                else
-                {
-                    instanceIds = &BattlegroundData[queueTypeId][bracketId].bgInstances;
-                }
+        AddBattlegroundQueueEntries(bot, true, snapshot->bots);
+    }
 
-                if (instanceIds)
-                {
-                    if (std::find(instanceIds->begin(), instanceIds->end(), instanceId) == instanceIds->end())
-                        instanceIds->push_back(instanceId);
-                }
+    sPlayerbotTaskScheduler->Schedule(
+        [this, snapshot]()
+        {
+            std::shared_ptr<BattlegroundInfoMap> data = std::make_shared<BattlegroundInfoMap>();
+            CountBattlegroundPlayers(*data, snapshot->players);
+            CountBattlegroundBots(*data, snapshot->bots);
+            AddAutoJoinInstances(*data);
+            LogBattlegroundInfo(*data);
 
-                if (isArena)
-                {
-                    if (isRated)
-                        BattlegroundData[queueTypeId][bracketId].ratedArenaInstanceCount = instanceIds->size();
-                    else
-                        BattlegroundData[queueTypeId][bracketId].skirmishArenaInstanceCount = instanceIds->size();
-                }
-                else
-                {
-                    BattlegroundData[queueTypeId][bracketId].bgInstanceCount = instanceIds->size();
-                }
-            }
-        }
-    }
+            std::lock_guard<std::mutex> guard(queueCheckLock);
+            checkedBattlegroundData = data;
+        });
+}
 
+void RandomPlayerbotMgr::AddAutoJoinInstances(BattlegroundInfoMap& data)
+{
     // Increase instance count if Bots are required to autojoin BG/Arenas
     if (sPlayerbotAIConfig->randomBotAutoJoinBG)
     {
@@ -792,37 +932,35 @@ void RandomPlayerbotMgr::CheckBgQueue()
         uint32 randomBotAutoJoinBGRatedArena5v5Count = sPlayerbotAIConfig->randomBotAutoJoinBGRatedArena5v5Count;
         uint32 randomBotAutoJoinBGWarsongCount = sPlayerbotAIConfig->randomBotAutoJoinBGWarsongCount;
 
-        BattlegroundData[BATTLEGROUND_QUEUE_2v2][randomBotAutoJoinArenaBracket].ratedArenaInstanceCount =
+        data[BATTLEGROUND_QUEUE_2v2][randomBotAutoJoinArenaBracket].ratedArenaInstanceCount =
             std::max(randomBotAutoJoinBGRatedArena2v2Count,
-                     (BattlegroundData[BATTLEGROUND_QUEUE_2v2][randomBotAutoJoinArenaBracket].ratedArenaInstanceCount -
+                     (data[BATTLEGROUND_QUEUE_2v2][randomBotAutoJoinArenaBracket].ratedArenaInstanceCount -
                       randomBotAutoJoinBGRatedArena2v2Count) +
                          randomBotAutoJoinBGRatedArena2v2Count);
 
-        BattlegroundData[BATTLEGROUND_QUEUE_3v3][randomBotAutoJoinArenaBracket].ratedArenaInstanceCount =
+        data[BATTLEGROUND_QUEUE_3v3][randomBotAutoJoinArenaBracket].ratedArenaInstanceCount =
             std::max(randomBotAutoJoinBGRatedArena3v3Count,
-                     (BattlegroundData[BATTLEGROUND_QUEUE_3v3][randomBotAutoJoinArenaBracket].ratedArenaInstanceCount -
+                     (data[BATTLEGROUND_QUEUE_3v3][randomBotAutoJoinArenaBracket].ratedArenaInstanceCount -
                       randomBotAutoJoinBGRatedArena3v3Count) +
                          randomBotAutoJoinBGRatedArena3v3Count);
 
-        BattlegroundData[BATTLEGROUND_QUEUE_5v5][randomBotAutoJoinArenaBracket].ratedArenaInstanceCount =
+        data[BATTLEGROUND_QUEUE_5v5][randomBotAutoJoinArenaBracket].ratedArenaInstanceCount =
             std::max(randomBotAutoJoinBGRatedArena5v5Count,
-                     (BattlegroundData[BATTLEGROUND_QUEUE_5v5][randomBotAutoJoinArenaBracket].ratedArenaInstanceCount -
+                     (data[BATTLEGROUND_QUEUE_5v5][randomBotAutoJoinArenaBracket].ratedArenaInstanceCount -
                       randomBotAutoJoinBGRatedArena5v5Count) +
                          randomBotAutoJoinBGRatedArena5v5Count);
 
-        BattlegroundData[BATTLEGROUND_QUEUE_WS][randomBotAutoJoinWarsongBracket].bgInstanceCount =
+        data[BATTLEGROUND_QUEUE_WS][randomBotAutoJoinWarsongBracket].bgInstanceCount =
             std::max(randomBotAutoJoinBGWarsongCount,
-                     (BattlegroundData[BATTLEGROUND_QUEUE_WS][randomBotAutoJoinWarsongBracket].bgInstanceCount -
+                     (data[BATTLEGROUND_QUEUE_WS][randomBotAutoJoinWarsongBracket].bgInstanceCount -
                       randomBotAutoJoinBGWarsongCount) +
                          randomBotAutoJoinBGWarsongCount);
     }
-
-    LogBattlegroundInfo();
 }
 
-void RandomPlayerbotMgr::LogBattlegroundInfo()
+void RandomPlayerbotMgr::LogBattlegroundInfo(BattlegroundInfoMap const& data)
 {
-    for (const auto& queueTypePair : BattlegroundData)
+    for (const auto& queueTypePair : data)
     {
         uint8 queueType = queueTypePair.first;
 
@@ -900,9 +1038,9 @@ void RandomPlayerbotMgr::CheckLfgQueue()
 
     LOG_INFO("playerbots", "Checking LFG Queue...");
 
-    // Clear LFG list
-    LfgDungeons[TEAM_ALLIANCE].clear();
-    LfgDungeons[TEAM_HORDE].clear();
+    // team and dungeon of every selected dungeon of a queued player, the LFG manager is only read here
+    std::shared_ptr<std::vector<std::pair<TeamId, uint32>>> snapshot =
+        std::make_shared<std::vector<std::pair<TeamId, uint32>>>();
 
     for (std::vector<Player*>::iterator i = players.begin(); i != players.end(); ++i)
     {
@@ -923,12 +1061,27 @@ void RandomPlayerbotMgr::CheckLfgQueue()
                 if (!dungeon)
                     continue;
 
-                LfgDungeons[player->GetTeamId()].push_back(dungeon->id);
+                snapshot->push_back(std::make_pair(player->GetTeamId(), dungeon->id));
             }
         }
     }
 
-    LOG_INFO("playerbots", "LFG Queue check finished");
+    sPlayerbotTaskScheduler->Schedule(
+        [this, snapshot]()
+        {
+            std::shared_ptr<std::map<TeamId, std::vector<uint32>>> dungeons =
+                std::make_shared<std::map<TeamId, std::vector<uint32>>>();
+            (*dungeons)[TEAM_ALLIANCE];
+            (*dungeons)[TEAM_HORDE];
+
+            for (std::pair<TeamId, uint32> const& dungeon : *snapshot)
+                (*dungeons)[dungeon.first].push_back(dungeon.second);
+
+            LOG_INFO("playerbots", "LFG Queue check finished");
+
+            std::lock_guard<std::mutex> guard(queueCheckLock);
+            checkedLfgDungeons = dungeons;
+        });
 }
 
 void RandomPlayerbotMgr::CheckPlayers()
@@ -938,8 +1091,8 @@ void RandomPlayerbotMgr::CheckPlayers()
 
     LOG_INFO("playerbots", "Checking Players...");
 
-    if (!playersLevel)
-        playersLevel = sPlayerbotAIConfig->randombotStartingLevel;
+    std::shared_ptr<std::vector<uint8>> levels = std::make_shared<std::vector<uint8>>();
+    levels->reserve(players.size());
 
     for (std::vector<Player*>::iterator i = players.begin(); i != players.end(); ++i)
     {
@@ -951,16 +1104,56 @@ void RandomPlayerbotMgr::CheckPlayers()
         // if (player->GetSession()->GetSecurity() > SEC_PLAYER)
         //     continue;
 
-        if (player->GetLevel() > playersLevel)
-            playersLevel = player->GetLevel() + 3;
+        levels->push_back(player->GetLevel());
+    }
+
+    uint32 currentLevel = playersLevel ? playersLevel : sPlayerbotAIConfig->randombotStartingLevel;
+
+    sPlayerbotTaskScheduler->Schedule(
+        [this, levels, currentLevel]()
+        {
+            uint32 level = currentLevel;
+            for (uint8 playerLevel : *levels)
+            {
+                if (playerLevel > level)
+                    level = playerLevel + 3;
+            }
+
+            LOG_INFO("playerbots", "Max player level is {}, max bot level set to {}", level - 3, level);
+
+            std::lock_guard<std::mutex> guard(queueCheckLock);
+            checkedPlayersLevel = level;
+        });
+}
+
+void RandomPlayerbotMgr::ApplyQueueChecks()
+{
+    std::shared_ptr<BattlegroundInfoMap> battlegroundData;
+    std::shared_ptr<std::map<TeamId, std::vector<uint32>>> lfgDungeons;
+    uint32 level;
+
+    {
+        std::lock_guard<std::mutex> guard(queueCheckLock);
+        battlegroundData.swap(checkedBattlegroundData);
+        lfgDungeons.swap(checkedLfgDungeons);
+        level = checkedPlayersLevel;
+        checkedPlayersLevel = 0;
     }
 
-    LOG_INFO("playerbots", "Max player level is {}, max bot level set to {}", playersLevel - 3, playersLevel);
+    // bots joining a queue adjust the counts between two checks, so a new check replaces them as a whole
+    if (battlegroundData)
+        BattlegroundData.swap(*battlegroundData);
+
+    if (lfgDungeons)
+        LfgDungeons.swap(*lfgDungeons);
+
+    if (level)
+        playersLevel = level;
 }
 
 void RandomPlayerbotMgr::ScheduleRandomize(uint32 bot, uint32 time)
 {
-    SetEventValue(bot, "randomize", 1, time);
+    SetEventValue(bot, RANDOM_BOT_EVENT_RANDOMIZE, 1, time);
 }
 
 void RandomPlayerbotMgr::ScheduleTeleport(uint32 bot, uint32 time)
@@ -968,7 +1161,7 @@ void RandomPlayerbotMgr::ScheduleTeleport(uint32 bot, uint32 time)
     if (!time)
         time = 60 + urand(sPlayerbotAIConfig->randomBotUpdateInterval, sPlayerbotAIConfig->randomBotUpdateInterval * 3);
 
-    SetEventValue(bot, "teleport", 1, time);
+    SetEventValue(bot, RANDOM_BOT_EVENT_TELEPORT, 1, time);
 }
 
 void RandomPlayerbotMgr::ScheduleChangeStrategy(uint32 bot, uint32 time)
@@ -977,7 +1170,7 @@ void RandomPlayerbotMgr::ScheduleChangeStrategy(uint32 bot, uint32 time)
         time = urand(sPlayerbotAIConfig->minRandomBotChangeStrategyTime,
                      sPlayerbotAIConfig->maxRandomBotChangeStrategyTime);
 
-    SetEventValue(bot, "change_strategy", 1, time);
+    SetEventValue(bot, RANDOM_BOT_EVENT_CHANGE_STRATEGY, 1, time);
 }
 
 bool RandomPlayerbotMgr::ProcessBot(uint32 bot)
@@ -987,7 +1180,7 @@ bool RandomPlayerbotMgr::ProcessBot(uint32 bot)
     Player* player = GetPlayerBot(botGUID);
     PlayerbotAI* botAI = player ? GET_PLAYERBOT_AI(player) : nullptr;
 
-    uint32 isValid = GetEventValue(bot, "add");
+    uint32 isValid = GetEventValue(bot, RANDOM_BOT_EVENT_ADD);
     if (!isValid)
     {
         if (!player || !player->GetGroup())
@@ -998,7 +1191,7 @@ bool RandomPlayerbotMgr::ProcessBot(uint32 bot)
             else
                 LOG_INFO("playerbots", "Bot #{}: log out", bot);
 
-            SetEventValue(bot, "add", 0, 0);
+            SetEventValue(bot, RANDOM_BOT_EVENT_ADD, 0, 0);
             currentBots.erase(std::remove(currentBots.begin(), currentBots.end(), bot), currentBots.end());
 
             if (player)
@@ -1008,7 +1201,7 @@ bool RandomPlayerbotMgr::ProcessBot(uint32 bot)
         return false;
     }
 
-    uint32 isLogginIn = GetEventValue(bot, "login");
+    uint32 isLogginIn = GetEventValue(bot, RANDOM_BOT_EVENT_LOGIN);
     if (isLogginIn)
         return false;
 
@@ -1017,21 +1210,21 @@ bool RandomPlayerbotMgr::ProcessBot(uint32 bot)
     {
         AddPlayerBot(botGUID, 0);
         randomTime = urand(1, 2);
-        SetEventValue(bot, "login", 1, randomTime);
+        SetEventValue(bot, RANDOM_BOT_EVENT_LOGIN, 1, randomTime);
 
         randomTime = urand(
             std::max(5, static_cast<int>(sPlayerbotAIConfig->randomBotUpdateInterval * 0.5)),
             std::max(12, static_cast<int>(sPlayerbotAIConfig->randomBotUpdateInterval * 2)));
-        SetEventValue(bot, "update", 1, randomTime);
+        SetEventValue(bot, RANDOM_BOT_EVENT_UPDATE, 1, randomTime);
 
         // do not randomize or teleport immediately after server start (prevent lagging)
-        if (!GetEventValue(bot, "randomize"))
+        if (!GetEventValue(bot, RANDOM_BOT_EVENT_RANDOMIZE))
         {
             randomTime = urand(
                 3,std::max(4, static_cast<int>(sPlayerbotAIConfig->randomBotUpdateInterval * 0.4)));
             ScheduleRandomize(bot, randomTime);
         }
-        if (!GetEventValue(bot, "teleport"))
+        if (!GetEventValue(bot, RANDOM_BOT_EVENT_TELEPORT))
         {
             randomTime = urand(
                 std::max(7, static_cast<int>(sPlayerbotAIConfig->randomBotUpdateInterval * 0.7)),
@@ -1042,7 +1235,7 @@ bool RandomPlayerbotMgr::ProcessBot(uint32 bot)
         return true;
     }
 
-    SetEventValue(bot, "login", 0, 0);
+    SetEventValue(bot, RANDOM_BOT_EVENT_LOGIN, 0, 0);
 
     if (!player->IsInWorld())
         return false;
@@ -1050,7 +1243,7 @@ bool RandomPlayerbotMgr::ProcessBot(uint32 bot)
     if (player->GetGroup() || player->HasUnitState(UNIT_STATE_IN_FLIGHT))
         return false;
 
-    uint32 update = GetEventValue(bot, "update");
+    uint32 update = GetEventValue(bot, RANDOM_BOT_EVENT_UPDATE);
     if (!update)
     {
         if (botAI)
@@ -1082,19 +1275,19 @@ bool RandomPlayerbotMgr::ProcessBot(uint32 bot)
         randomTime = urand(
             sPlayerbotAIConfig->minRandomBotReviveTime,
             sPlayerbotAIConfig->maxRandomBotReviveTime);
-        SetEventValue(bot, "update", 1, randomTime);
+        SetEventValue(bot, RANDOM_BOT_EVENT_UPDATE, 1, randomTime);
 
         return true;
     }
 
-    uint32 logout = GetEventValue(bot, "logout");
+    uint32 logout = GetEventValue(bot, RANDOM_BOT_EVENT_LOGOUT);
     if (player && !logout && !isValid)
     {
         LOG_INFO("playerbots", "Bot #{} {}:{} <{}>: log out", bot, IsAlliance(player->getRace()) ? "A" : "H",
                  player->GetLevel(), player->GetName().c_str());
         LogoutPlayerBot(botGUID);
         currentBots.remove(bot);
-        SetEventValue(bot, "logout", 1, urand(
+        SetEventValue(bot, RANDOM_BOT_EVENT_LOGOUT, 1, urand(
             sPlayerbotAIConfig->minRandomBotInWorldTime, 
             sPlayerbotAIConfig->maxRandomBotInWorldTime));
         return true;
@@ -1119,19 +1312,19 @@ bool RandomPlayerbotMgr::ProcessBot(Player* player)
     // if death revive
     if (player->isDead())
     {
-        if (!GetEventValue(bot, "dead"))
+        if (!GetEventValue(bot, RANDOM_BOT_EVENT_DEAD))
         {
             uint32 randomTime = urand(
                 sPlayerbotAIConfig->minRandomBotReviveTime, 
                 sPlayerbotAIConfig->maxRandomBotReviveTime);
             LOG_INFO("playerbots", "Mark bot {} as dead, will be revived in {}s.", 
                 player->GetName().c_str(), randomTime);
-            SetEventValue(bot, "dead", 1, sPlayerbotAIConfig->maxRandomBotInWorldTime);
-            SetEventValue(bot, "revive", 1, randomTime);
+            SetEventValue(bot, RANDOM_BOT_EVENT_DEAD, 1, sPlayerbotAIConfig->maxRandomBotInWorldTime);
+            SetEventValue(bot, RANDOM_BOT_EVENT_REVIVE, 1, randomTime);
             return false;
         }
 
-        if (!GetEventValue(bot, "revive"))
+        if (!GetEventValue(bot, RANDOM_BOT_EVENT_REVIVE))
         {
             Revive(player);
             return true;
@@ -1169,7 +1362,7 @@ bool RandomPlayerbotMgr::ProcessBot(Player* player)
     if (idleBot)
     {
         // randomize
-        uint32 randomize = GetEventValue(bot, "randomize");
+        uint32 randomize = GetEventValue(bot, RANDOM_BOT_EVENT_RANDOMIZE);
         if (!randomize)
         {
              // bool randomiser = true;
@@ -1203,7 +1396,7 @@ bool RandomPlayerbotMgr::ProcessBot(Player* player)
             return true;
         }
 
-        // uint32 changeStrategy = GetEventValue(bot, "change_strategy");
+        // uint32 changeStrategy = GetEventValue(bot, RANDOM_BOT_EVENT_CHANGE_STRATEGY);
         // if (!changeStrategy)
         // {
         //     LOG_INFO("playerbots", "Changing strategy for bot  #{} <{}>", bot, player->GetName().c_str());
@@ -1211,7 +1404,7 @@ bool RandomPlayerbotMgr::ProcessBot(Player* player)
         //     return true;
         // }
 
-        uint32 teleport = GetEventValue(bot, "teleport");
+        uint32 teleport = GetEventValue(bot, RANDOM_BOT_EVENT_TELEPORT);
         if (!teleport)
         {
             LOG_INFO("playerbots", "Bot #{} <{}>: teleport for level and refresh", bot, player->GetName());
@@ -1233,8 +1426,8 @@ void RandomPlayerbotMgr::Revive(Player* player)
     uint32 bot = player->GetGUID().GetCounter();
 
     // LOG_INFO("playerbots", "Bot {} revived", player->GetName().c_str());
-    SetEventValue(bot, "dead", 0, 0);
-    SetEventValue(bot, "revive", 0, 0);
+    SetEventValue(bot, RANDOM_BOT_EVENT_DEAD, 0, 0);
+    SetEventValue(bot, RANDOM_BOT_EVENT_REVIVE, 0, 0);
 
     Refresh(player);
     RandomTeleportGrindForLevel(player);
@@ -1741,17 +1934,8 @@ void RandomPlayerbotMgr::RandomizeFirst(Player* bot)
     uint32 inworldTime =
         urand(sPlayerbotAIConfig->minRandomBotInWorldTime, sPlayerbotAIConfig->maxRandomBotInWorldTime);
 
-    PlayerbotsDatabasePreparedStatement* stmt = PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_UPD_RANDOM_BOTS);
-    stmt->SetData(0, randomTime);
-    stmt->SetData(1, "bot_delete");
-    stmt->SetData(2, bot->GetGUID().GetCounter());
-    PlayerbotsDatabase.Execute(stmt);
-
-    stmt = PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_UPD_RANDOM_BOTS);
-    stmt->SetData(0, inworldTime);
-    stmt->SetData(1, "logout");
-    stmt->SetData(2, bot->GetGUID().GetCounter());
-    PlayerbotsDatabase.Execute(stmt);
+    SetEventValidIn(bot->GetGUID().GetCounter(), RANDOM_BOT_EVENT_BOT_DELETE, randomTime);
+    SetEventValidIn(bot->GetGUID().GetCounter(), RANDOM_BOT_EVENT_LOGOUT, inworldTime);
 
     // teleport to a random inn for bot level
     if (GET_PLAYERBOT_AI(bot))
@@ -1782,17 +1966,8 @@ void RandomPlayerbotMgr::RandomizeMin(Player* bot)
     uint32 inworldTime =
         urand(sPlayerbotAIConfig->minRandomBotInWorldTime, sPlayerbotAIConfig->maxRandomBotInWorldTime);
 
-    PlayerbotsDatabasePreparedStatement* stmt = PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_UPD_RANDOM_BOTS);
-    stmt->SetData(0, randomTime);
-    stmt->SetData(1, "bot_delete");
-    stmt->SetData(2, bot->GetGUID().GetCounter());
-    PlayerbotsDatabase.Execute(stmt);
-
-    stmt = PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_UPD_RANDOM_BOTS);
-    stmt->SetData(0, inworldTime);
-    stmt->SetData(1, "logout");
-    stmt->SetData(2, bot->GetGUID().GetCounter());
-    PlayerbotsDatabase.Execute(stmt);
+    SetEventValidIn(bot->GetGUID().GetCounter(), RANDOM_BOT_EVENT_BOT_DELETE, randomTime);
+    SetEventValidIn(bot->GetGUID().GetCounter(), RANDOM_BOT_EVENT_LOGOUT, inworldTime);
 
     // teleport to a random inn for bot level
     if (GET_PLAYERBOT_AI(bot))
@@ -1918,23 +2093,17 @@ void RandomPlayerbotMgr::GetBots()
     if (!currentBots.empty())
         return;
 
-    PlayerbotsDatabasePreparedStatement* stmt =
-        PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_SEL_RANDOM_BOTS_BY_OWNER_AND_EVENT);
-    stmt->SetData(0, 0);
-    stmt->SetData(1, "add");
-    uint32 maxAllowedBotCount = GetEventValue(0, "bot_count");
-    if (PreparedQueryResult result = PlayerbotsDatabase.Query(stmt))
+    // the event cache holds every stored event, including adds not flushed yet
+    uint32 maxAllowedBotCount = GetEventValue(0, RANDOM_BOT_EVENT_BOT_COUNT);
+
+    std::lock_guard<std::mutex> guard(eventLock);
+    for (auto& [bot, botEvents] : eventCache)
     {
-        do
-        {
-            Field* fields = result->Fetch();
-            uint32 bot = fields[0].Get<uint32>();
-            if (GetEventValue(bot, "add"))
-                currentBots.push_back(bot);
+        if (currentBots.size() >= maxAllowedBotCount)
+            break;
 
-            if (currentBots.size() >= maxAllowedBotCount)
-                break;
-        } while (result->NextRow());
+        if (bot && GetEventValue(botEvents.events[RANDOM_BOT_EVENT_ADD], true))
+            currentBots.push_back(bot);
     }
 }
 
@@ -1961,104 +2130,255 @@ std::vector<uint32> RandomPlayerbotMgr::GetBgBots(uint32 bracket)
     return std::move(BgBots);
 }
 
-uint32 RandomPlayerbotMgr::GetEventValue(uint32 bot, std::string const event)
+// names of the RandomBotEvent values in playerbots_random_bots
+static char const* const randomBotEventNames[MAX_RANDOM_BOT_EVENT] = {
+    "add", "bot_count", "bot_delete", "buymultiplier", "change_strategy", "dead", "firstSkill", "level", "login",
+    "logout", "randomize", "revive", "secondSkill", "sellmultiplier", "specLink", "specNo", "teleport", "update"};
+
+static RandomBotEvent GetRandomBotEvent(std::string const& name)
 {
-    // load all events at once on first event load
-    if (eventCache[bot].empty())
+    for (uint8 i = 0; i < MAX_RANDOM_BOT_EVENT; ++i)
     {
-        PlayerbotsDatabasePreparedStatement* stmt =
-            PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_SEL_RANDOM_BOTS_BY_OWNER_AND_BOT);
-        stmt->SetData(0, 0);
-        stmt->SetData(1, bot);
-        if (PreparedQueryResult result = PlayerbotsDatabase.Query(stmt))
-        {
-            do
-            {
-                Field* fields = result->Fetch();
-                std::string const eventName = fields[0].Get<std::string>();
-
-                CachedEvent e;
-                e.value = fields[1].Get<uint32>();
-                e.lastChangeTime = fields[2].Get<uint32>();
-                e.validIn = fields[3].Get<uint32>();
-                e.data = fields[4].Get<std::string>();
-                eventCache[bot][eventName] = std::move(e);
-            } while (result->NextRow());
-        }
+        if (name == randomBotEventNames[i])
+            return RandomBotEvent(i);
     }
 
-    CachedEvent& e = eventCache[bot][event];
-    /*if (e.IsEmpty())
-    {
-        QueryResult results = PlayerbotsDatabase.Query("SELECT `value`, `time`, validIn, `data` FROM
-    playerbots_random_bots WHERE owner = 0 AND bot = {} AND event = {}", bot, event.c_str());
+    return MAX_RANDOM_BOT_EVENT;
+}
 
-        if (results)
+// events that keep their value after validIn elapsed
+static bool IsPermanentEvent(RandomBotEvent event)
+{
+    return event == RANDOM_BOT_EVENT_SPEC_NO || event == RANDOM_BOT_EVENT_SPEC_LINK;
+}
+
+void RandomPlayerbotMgr::LoadEvents()
+{
+    uint32 oldMSTime = getMSTime();
+
+    // one query for all bots instead of one per bot on its first event
+    PlayerbotsDatabasePreparedStatement* stmt =
+        PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_SEL_RANDOM_BOTS_BY_OWNER);
+    stmt->SetData(0, 0);
+
+    std::map<uint32, RandomBotEvents> events;
+    uint32 count = 0;
+    if (PreparedQueryResult result = PlayerbotsDatabase.Query(stmt))
+    {
+        do
         {
-            Field* fields = results->Fetch();
-            e.value = fields[0].Get<uint32>();
-            e.lastChangeTime = fields[1].Get<uint32>();
-            e.validIn = fields[2].Get<uint32>();
-            e.data = fields[3].Get<std::string>();
-        }
+            Field* fields = result->Fetch();
+            RandomBotEvents& botEvents = events[fields[0].Get<uint32>()];
+            std::string const eventName = fields[1].Get<std::string>();
+
+            RandomBotEvent type = GetRandomBotEvent(eventName);
+            CachedEvent& e = type != MAX_RANDOM_BOT_EVENT ? botEvents.events[type] : botEvents.others[eventName];
+            e.value = fields[2].Get<uint32>();
+            e.lastChangeTime = fields[3].Get<uint32>();
+            e.validIn = fields[4].Get<uint32>();
+            e.data = fields[5].Get<std::string>();
+            ++count;
+        } while (result->NextRow());
     }
-    */
 
-    if ((time(0) - e.lastChangeTime) >= e.validIn && event != "specNo" && event != "specLink")
+    std::lock_guard<std::mutex> guard(eventLock);
+    // a reload of the config must not drop changes that were not flushed yet
+    if (eventsLoaded)
+        return;
+
+    eventCache = std::move(events);
+    eventsLoaded = true;
+
+    LOG_INFO("playerbots", ">> Loaded {} random bot events for {} bots in {} ms", count, eventCache.size(),
+             GetMSTimeDiffToNow(oldMSTime));
+}
+
+RandomBotEvents& RandomPlayerbotMgr::GetBotEvents(uint32 bot) { return eventCache[bot]; }
+
+CachedEvent& RandomPlayerbotMgr::GetCachedEvent(uint32 bot, std::string const event)
+{
+    RandomBotEvents& botEvents = GetBotEvents(bot);
+
+    RandomBotEvent type = GetRandomBotEvent(event);
+    if (type != MAX_RANDOM_BOT_EVENT)
+        return botEvents.events[type];
+
+    return botEvents.others[event];
+}
+
+uint32 RandomPlayerbotMgr::GetEventValue(CachedEvent& e, bool expires)
+{
+    if (expires && (time(0) - e.lastChangeTime) >= e.validIn)
         e.value = 0;
 
     return e.value;
 }
 
+uint32 RandomPlayerbotMgr::GetEventValue(uint32 bot, RandomBotEvent event)
+{
+    std::lock_guard<std::mutex> guard(eventLock);
+    return GetEventValue(GetBotEvents(bot).events[event], !IsPermanentEvent(event));
+}
+
+uint32 RandomPlayerbotMgr::GetEventValue(uint32 bot, std::string const event)
+{
+    RandomBotEvent type = GetRandomBotEvent(event);
+    if (type != MAX_RANDOM_BOT_EVENT)
+        return GetEventValue(bot, type);
+
+    std::lock_guard<std::mutex> guard(eventLock);
+    return GetEventValue(GetBotEvents(bot).others[event], true);
+}
+
 std::string const RandomPlayerbotMgr::GetEventData(uint32 bot, std::string const event)
 {
-    std::string data = "";
-    if (GetEventValue(bot, event))
-    {
-        CachedEvent e = eventCache[bot][event];
-        data = e.data;
-    }
+    RandomBotEvent type = GetRandomBotEvent(event);
+
+    std::lock_guard<std::mutex> guard(eventLock);
+    CachedEvent& e = GetCachedEvent(bot, event);
+    if (!GetEventValue(e, type == MAX_RANDOM_BOT_EVENT || !IsPermanentEvent(type)))
+        return "";
+
+    return e.data;
+}
+
+uint32 RandomPlayerbotMgr::SetEventValue(uint32 bot, RandomBotEvent event, uint32 value, uint32 validIn,
+                                         std::string const data)
+{
+    std::lock_guard<std::mutex> guard(eventLock);
+    GetBotEvents(bot).events[event] = CachedEvent(value, (uint32)time(nullptr), validIn, data);
 
-    return data;
+    // written by the next FlushEvents, later changes of the same event replace this one
+    dirtyEvents.emplace(bot, event);
+    return value;
 }
 
 uint32 RandomPlayerbotMgr::SetEventValue(uint32 bot, std::string const event, uint32 value, uint32 validIn,
                                          std::string const data)
 {
+    RandomBotEvent type = GetRandomBotEvent(event);
+    if (type != MAX_RANDOM_BOT_EVENT)
+        return SetEventValue(bot, type, value, validIn, data);
+
+    std::lock_guard<std::mutex> guard(eventLock);
+    GetBotEvents(bot).others[event] = CachedEvent(value, (uint32)time(nullptr), validIn, data);
+    dirtyNamedEvents.emplace(bot, event);
+    return value;
+}
+
+void RandomPlayerbotMgr::SetEventValidIn(uint32 bot, RandomBotEvent event, uint32 validIn)
+{
+    std::lock_guard<std::mutex> guard(eventLock);
+
+    // like an UPDATE of the stored row, events that are not set stay unset
+    CachedEvent& e = GetBotEvents(bot).events[event];
+    if (!e.value)
+        return;
+
+    e.validIn = validIn;
+    dirtyEvents.emplace(bot, event);
+}
+
+void RandomPlayerbotMgr::FlushEvents()
+{
+    eventsFlushTime = time(nullptr) + sPlayerbotAIConfig->randomBotEventFlushInterval;
+
+    // the changed events are copied under the lock, the statements are built without holding it
+    struct FlushedEvent
+    {
+        uint32 bot;
+        std::string name;
+        CachedEvent event;
+    };
+
+    std::vector<FlushedEvent> flushed;
+    {
+        std::lock_guard<std::mutex> guard(eventLock);
+        flushed.reserve(dirtyEvents.size() + dirtyNamedEvents.size());
+        for (auto const& [bot, event] : dirtyEvents)
+            flushed.push_back({bot, randomBotEventNames[event], GetBotEvents(bot).events[event]});
+
+        for (auto const& [bot, name] : dirtyNamedEvents)
+            flushed.push_back({bot, name, GetBotEvents(bot).others[name]});
+
+        dirtyEvents.clear();
+        dirtyNamedEvents.clear();
+    }
+
+    if (flushed.empty())
+        return;
+
     PlayerbotsDatabaseTransaction trans = PlayerbotsDatabase.BeginTransaction();
 
-    PlayerbotsDatabasePreparedStatement* stmt =
-        PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_DEL_RANDOM_BOTS_BY_OWNER_AND_EVENT);
-    stmt->SetData(0, 0);
-    stmt->SetData(1, bot);
-    stmt->SetData(2, event.c_str());
-    trans->Append(stmt);
-
-    if (value)
-    {
-        stmt = PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_INS_RANDOM_BOTS);
-        stmt->SetData(0, 0);
-        stmt->SetData(1, bot);
-        stmt->SetData(2, static_cast<uint32>(GameTime::GetGameTime().count()));
-        stmt->SetData(3, validIn);
-        stmt->SetData(4, event.c_str());
-        stmt->SetData(5, value);
-        if (data != "")
+    // bots of every event that was unset, removed with one statement per event
+    std::map<std::string, std::vector<uint32>> deletedEvents;
+    std::ostringstream upsert;
+    uint32 rows = 0;
+
+    auto appendUpsert = [&]()
+    {
+        upsert << " ON DUPLICATE KEY UPDATE `time` = VALUES(`time`), validIn = VALUES(validIn), "
+                  "`value` = VALUES(`value`), `data` = VALUES(`data`)";
+        trans->Append(upsert.str());
+        upsert.str("");
+        rows = 0;
+    };
+
+    for (FlushedEvent const& flushedEvent : flushed)
+    {
+        uint32 bot = flushedEvent.bot;
+        std::string const& name = flushedEvent.name;
+        CachedEvent const& e = flushedEvent.event;
+        if (!e.value)
         {
-            stmt->SetData(6, data.c_str());
+            deletedEvents[name].push_back(bot);
+            continue;
         }
+
+        std::string eventName = name;
+        std::string data = e.data;
+        PlayerbotsDatabase.EscapeString(eventName);
+        PlayerbotsDatabase.EscapeString(data);
+
+        if (!rows)
+            upsert << "INSERT INTO playerbots_random_bots (owner, bot, `time`, validIn, event, `value`, `data`) "
+                      "VALUES ";
         else
+            upsert << ", ";
+
+        upsert << "(0, " << bot << ", " << e.lastChangeTime << ", " << e.validIn << ", '" << eventName << "', "
+               << e.value << ", ";
+        if (data.empty())
+            upsert << "NULL)";
+        else
+            upsert << "'" << data << "')";
+
+        if (++rows >= RANDOM_BOT_EVENT_FLUSH_ROWS)
+            appendUpsert();
+    }
+
+    if (rows)
+        appendUpsert();
+
+    for (auto& [name, bots] : deletedEvents)
+    {
+        std::string eventName = name;
+        PlayerbotsDatabase.EscapeString(eventName);
+
+        for (uint32 first = 0; first < bots.size(); first += RANDOM_BOT_EVENT_FLUSH_ROWS)
         {
-            stmt->SetData(6);
+            std::ostringstream remove;
+            remove << "DELETE FROM playerbots_random_bots WHERE owner = 0 AND event = '" << eventName
+                   << "' AND bot IN (";
+            for (uint32 i = first; i < bots.size() && i < first + RANDOM_BOT_EVENT_FLUSH_ROWS; ++i)
+                remove << (i == first ? "" : ", ") << bots[i];
+
+            remove << ")";
+            trans->Append(remove.str());
         }
-        trans->Append(stmt);
     }
 
     PlayerbotsDatabase.CommitTransaction(trans);
-
-    CachedEvent e(value, (uint32)time(nullptr), validIn, data);
-    eventCache[bot][event] = std::move(e);
-    return value;
 }
 
 uint32 RandomPlayerbotMgr::GetValue(uint32 bot, std::string const type) { return GetEventValue(bot, type); }
@@ -2099,7 +2419,10 @@ bool RandomPlayerbotMgr::HandlePlayerbotConsoleCommand(ChatHandler* handler, cha
     if (cmd == "reset")
     {
         PlayerbotsDatabase.Execute(PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_DEL_RANDOM_BOTS));
+        std::lock_guard<std::mutex> guard(sRandomPlayerbotMgr->eventLock);
         sRandomPlayerbotMgr->eventCache.clear();
+        sRandomPlayerbotMgr->dirtyEvents.clear();
+        sRandomPlayerbotMgr->dirtyNamedEvents.clear();
         LOG_INFO("playerbots", "Random bots were reset for all players. Please restart the Server.");
         return true;
     }
@@ -2201,26 +2524,38 @@ bool RandomPlayerbotMgr::HandlePlayerbotConsoleCommand(ChatHandler* handler, cha
     return true;
 }
 
-void RandomPlayerbotMgr::HandleCommand(uint32 type, std::string const text, Player* fromPlayer, std::string channelName)
+void RandomPlayerbotMgr::HandleCommand(uint32 type, std::string const text, Player* fromPlayer, Channel* channel)
 {
-    for (PlayerBotMap::const_iterator it = GetPlayerBotsBegin(); it != GetPlayerBotsEnd(); ++it)
-    {
-        Player* const bot = it->second;
-        if (!bot)
-            continue;
+    if (type == CHAT_MSG_ADDON || type == CHAT_MSG_SYSTEM)
+        return;
 
-        if (!channelName.empty())
-        {
-            if (ChannelMgr* cMgr = ChannelMgr::forTeam(bot->GetTeamId()))
+    // parsed once for all bots, a line holding no command for them is not handed out at all
+    std::shared_ptr<PlayerbotChatMessage const> message = sPlayerbotChatCache->Get(fromPlayer->GetGUID(), text);
+    if (message->GetCommands().empty())
+        return;
+
+    // only the members of the channel hear it, a command may make a bot leave so they are collected first
+    std::vector<Player*> bots;
+    if (channel)
+    {
+        channel->DoForAllPlayers(
+            [this, &bots](ObjectGuid guid)
             {
-                Channel* chn = cMgr->GetChannel(channelName, bot);
-                if (!chn)
-                    continue;
-            }
+                if (Player* bot = GetPlayerBot(guid))
+                    bots.push_back(bot);
+            });
+    }
+    else
+    {
+        for (PlayerBotMap::const_iterator it = GetPlayerBotsBegin(); it != GetPlayerBotsEnd(); ++it)
+        {
+            if (it->second)
+                bots.push_back(it->second);
         }
-
-        GET_PLAYERBOT_AI(bot)->HandleCommand(type, text, fromPlayer);
     }
+
+    for (Player* bot : bots)
+        GET_PLAYERBOT_AI(bot)->HandleCommand(type, *message, fromPlayer);
 }
 
 void RandomPlayerbotMgr::OnPlayerLogout(Player* player)
@@ -2333,7 +2668,7 @@ void RandomPlayerbotMgr::OnPlayerLogin(Player* player)
     if (IsRandomBot(player))
     {
         ObjectGuid::LowType guid = player->GetGUID().GetCounter();
-        SetEventValue(guid, "login", 0, 0);
+        SetEventValue(guid, RANDOM_BOT_EVENT_LOGIN, 0, 0);
     }
     else
     {
@@ -2344,7 +2679,7 @@ void RandomPlayerbotMgr::OnPlayerLogin(Player* player)
 
 void RandomPlayerbotMgr::OnPlayerLoginError(uint32 bot)
 {
-    SetEventValue(bot, "add", 0, 0);
+    SetEventValue(bot, RANDOM_BOT_EVENT_ADD, 0, 0);
     currentBots.erase(std::remove(currentBots.begin(), currentBots.end(), bot), currentBots.end());
 }
 
@@ -2420,19 +2755,19 @@ void RandomPlayerbotMgr::PrintStats()
             ++update;
 
         uint32 botId = bot->GetGUID().GetCounter();
-        if (!GetEventValue(botId, "randomize"))
+        if (!GetEventValue(botId, RANDOM_BOT_EVENT_RANDOMIZE))
             ++randomize;
 
-        if (!GetEventValue(botId, "teleport"))
+        if (!GetEventValue(botId, RANDOM_BOT_EVENT_TELEPORT))
             ++teleport;
 
-        if (!GetEventValue(botId, "change_strategy"))
+        if (!GetEventValue(botId, RANDOM_BOT_EVENT_CHANGE_STRATEGY))
             ++changeStrategy;
 
         if (bot->isDead())
         {
             ++dead;
-            // if (!GetEventValue(botId, "dead"))
+            // if (!GetEventValue(botId, RANDOM_BOT_EVENT_DEAD))
             //++revive;
         }
         if (bot->IsInCombat())
@@ -2578,13 +2913,13 @@ void RandomPlayerbotMgr::PrintStats()
 double RandomPlayerbotMgr::GetBuyMultiplier(Player* bot)
 {
     uint32 id = bot->GetGUID().GetCounter();
-    uint32 value = GetEventValue(id, "buymultiplier");
+    uint32 value = GetEventValue(id, RANDOM_BOT_EVENT_BUY_MULTIPLIER);
     if (!value)
     {
         value = urand(50, 120);
         uint32 validIn = urand(sPlayerbotAIConfig->minRandomBotsPriceChangeInterval,
                                sPlayerbotAIConfig->maxRandomBotsPriceChangeInterval);
-        SetEventValue(id, "buymultiplier", value, validIn);
+        SetEventValue(id, RANDOM_BOT_EVENT_BUY_MULTIPLIER, value, validIn);
     }
 
     return (double)value / 100.0;
@@ -2593,13 +2928,13 @@ double RandomPlayerbotMgr::GetBuyMultiplier(Player* bot)
 double RandomPlayerbotMgr::GetSellMultiplier(Player* bot)
 {
     uint32 id = bot->GetGUID().GetCounter();
-    uint32 value = GetEventValue(id, "sellmultiplier");
+    uint32 value = GetEventValue(id, RANDOM_BOT_EVENT_SELL_MULTIPLIER);
     if (!value)
     {
         value = urand(80, 250);
         uint32 validIn = urand(sPlayerbotAIConfig->minRandomBotsPriceChangeInterval,
                                sPlayerbotAIConfig->maxRandomBotsPriceChangeInterval);
-        SetEventValue(id, "sellmultiplier", value, validIn);
+        SetEventValue(id, RANDOM_BOT_EVENT_SELL_MULTIPLIER, value, validIn);
     }
 
     return (double)value / 100.0;
@@ -2680,7 +3015,7 @@ void RandomPlayerbotMgr::ChangeStrategy(Player* player)
         LOG_INFO("playerbots", "Changing strategy for bot #{} <{}> to RPG", bot, player->GetName().c_str());
         LOG_INFO("playerbots", "Bot #{} <{}>: sent to inn", bot, player->GetName().c_str());
         RandomTeleportForLevel(player);
-        SetEventValue(bot, "teleport", 1, sPlayerbotAIConfig->maxRandomBotInWorldTime);
+        SetEventValue(bot, RANDOM_BOT_EVENT_TELEPORT, 1, sPlayerbotAIConfig->maxRandomBotInWorldTime);
     }
 
     ScheduleChangeStrategy(bot);
@@ -2722,7 +3057,15 @@ void RandomPlayerbotMgr::Remove(Player* bot)
     stmt->SetData(1, owner.GetCounter());
     PlayerbotsDatabase.Execute(stmt);
 
-    eventCache[owner.GetCounter()].clear();
+    {
+        std::lock_guard<std::mutex> guard(eventLock);
+        uint32 bot = owner.GetCounter();
+        eventCache.erase(bot);
+        // pending changes would bring the removed rows back, the journals are sorted by bot
+        dirtyEvents.erase(dirtyEvents.lower_bound({bot, RandomBotEvent(0)}),
+                          dirtyEvents.lower_bound({bot + 1, RandomBotEvent(0)}));
+        dirtyNamedEvents.erase(dirtyNamedEvents.lower_bound({bot, ""}), dirtyNamedEvents.lower_bound({bot + 1, ""}));
+    }
 
     LogoutPlayerBot(owner);
 }
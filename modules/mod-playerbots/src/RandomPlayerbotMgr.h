@@ -6,8 +6,18 @@
 #ifndef _PLAYERBOT_RANDOMPLAYERBOTMGR_H
 #define _PLAYERBOT_RANDOMPLAYERBOTMGR_H
 
+#include <array>
+#include <memory>
+#include <mutex>
+#include <set>
+
+#include "AsyncCallbackProcessor.h"
 #include "ObjectGuid.h"
 #include "PlayerbotMgr.h"
+#include "QueryCallback.h"
+
+// one millisecond buckets of the population update time histogram, the last one holds every slower update
+#define POPULATION_UPDATE_BUCKETS 500
 
 struct BattlegroundInfo
 {
@@ -40,10 +50,60 @@ struct BattlegroundInfo
     uint32 bgAlliancePlayerCount = 0;
 };
 
+typedef std::map<uint32, std::map<uint32, BattlegroundInfo>> BattlegroundInfoMap;
+
+// One battleground queue of a player or random bot as it was when CheckBgQueue ran
+struct BattlegroundQueueEntry
+{
+    uint32 queueTypeId;
+    uint32 bracketId;
+    uint32 minLevel;
+    uint32 maxLevel;
+    TeamId teamId;
+    bool isBot;
+    bool isArena;
+    bool isRated;
+    bool isWaiting;  // neither invited nor inside the battleground yet
+    bool inArena;
+    bool inRatedArena;
+    uint32 instanceId;  // battleground the player is inside, 0 while queued
+};
+
+struct BattlegroundQueueSnapshot
+{
+    std::vector<BattlegroundQueueEntry> players;
+    std::vector<BattlegroundQueueEntry> bots;
+};
+
+class Channel;
 class ChatHandler;
 class PerformanceMonitorOperation;
 class WorldLocation;
 
+// Events every random bot may have, stored in playerbots_random_bots under the names in RandomPlayerbotMgr.cpp
+enum RandomBotEvent : uint8
+{
+    RANDOM_BOT_EVENT_ADD = 0,
+    RANDOM_BOT_EVENT_BOT_COUNT,
+    RANDOM_BOT_EVENT_BOT_DELETE,
+    RANDOM_BOT_EVENT_BUY_MULTIPLIER,
+    RANDOM_BOT_EVENT_CHANGE_STRATEGY,
+    RANDOM_BOT_EVENT_DEAD,
+    RANDOM_BOT_EVENT_FIRST_SKILL,
+    RANDOM_BOT_EVENT_LEVEL,
+    RANDOM_BOT_EVENT_LOGIN,
+    RANDOM_BOT_EVENT_LOGOUT,
+    RANDOM_BOT_EVENT_RANDOMIZE,
+    RANDOM_BOT_EVENT_REVIVE,
+    RANDOM_BOT_EVENT_SECOND_SKILL,
+    RANDOM_BOT_EVENT_SELL_MULTIPLIER,
+    RANDOM_BOT_EVENT_SPEC_LINK,
+    RANDOM_BOT_EVENT_SPEC_NO,
+    RANDOM_BOT_EVENT_TELEPORT,
+    RANDOM_BOT_EVENT_UPDATE,
+    MAX_RANDOM_BOT_EVENT
+};
+
 class CachedEvent
 {
 public:
@@ -66,6 +126,21 @@ public:
     std::string data;
 };
 
+// Character of a random bot account, all AddRandomBots needs to pick bots without asking the database
+struct RandomBotCharacter
+{
+    uint32 guid;
+    uint8 cls;
+    uint8 level;
+};
+
+// All events of one bot, events with generated names like trade discounts are kept by name
+struct RandomBotEvents
+{
+    CachedEvent events[MAX_RANDOM_BOT_EVENT];
+    std::map<std::string, CachedEvent> others;
+};
+
 // https://gist.github.com/bradley219/5373998
 
 class botPIDImpl;
@@ -80,6 +155,7 @@ public:
     // min - minimum value of manipulated variable
     botPID(double dt, double max, double min, double Kp, double Ki, double Kd);
     void adjust(double Kp, double Ki, double Kd);
+    void setLimits(double max, double min);
     void reset();
 
     double calculate(double setpoint, double pv);
@@ -118,7 +194,7 @@ public:
     void IncreaseLevel(Player* bot);
     void ScheduleTeleport(uint32 bot, uint32 time = 0);
     void ScheduleChangeStrategy(uint32 bot, uint32 time = 0);
-    void HandleCommand(uint32 type, std::string const text, Player* fromPlayer, std::string channelName = "");
+    void HandleCommand(uint32 type, std::string const text, Player* fromPlayer, Channel* channel = nullptr);
     std::string const HandleRemoteCommand(std::string const request);
     void OnPlayerLogout(Player* player);
     void OnPlayerLogin(Player* player);
@@ -150,14 +226,16 @@ public:
     ObjectGuid const GetBattleMasterGUID(Player* bot, BattlegroundTypeId bgTypeId);
     CreatureData const* GetCreatureDataByEntry(uint32 entry);
     void LoadBattleMastersCache();
-    std::map<uint32, std::map<uint32, BattlegroundInfo>> BattlegroundData;
+    BattlegroundInfoMap BattlegroundData;
     std::map<uint32, std::map<uint32, std::map<TeamId, uint32>>> VisualBots;
     std::map<uint32, std::map<uint32, std::map<uint32, uint32>>> Supporters;
     std::map<TeamId, std::vector<uint32>> LfgDungeons;
     void CheckBgQueue();
     void CheckLfgQueue();
+    // the checks copy what they need on the world thread, count it on the task scheduler and the results are
+    // applied by the next update
     void CheckPlayers();
-    void LogBattlegroundInfo();
+    void LogBattlegroundInfo(BattlegroundInfoMap const& data);
 
     std::map<TeamId, std::map<BattlegroundTypeId, std::vector<uint32>>> getBattleMastersCache()
     {
@@ -171,23 +249,46 @@ public:
 
     void PrepareAddclassCache();
     std::map<uint8, std::vector<ObjectGuid>> addclassCache;
+    // reads every stored event once at startup, so map threads never wait for the database on their first event
+    void LoadEvents();
+    // writes all event changes since the last flush as a few multi-row statements
+    void FlushEvents();
+    void OnBotCharacterCreate(Player* player);
+    void OnBotCharacterDelete(uint32 guid);
+    void OnBotCharacterLevelChanged(Player* player);
+    // collects world update times until all random bots are online, then logs how long that took
+    void UpdatePopulationStats();
 protected:
     void OnBotLoginInternal(Player* const bot) override;
+    uint32 GetLoginTimeBudget() override;
 
 private:
     // pid values are set in constructor
     botPID pid = botPID(1, 50, -50, 0, 0, 0);
+    // ms per tick spent adding bots to the world, driven by the average world update time and limited by
+    // AiPlayerbot.BotLoginMaxTimeBudget before every calculation
+    botPID loginPid = botPID(1, 1, 1, 0.2, 0.02, 0);
     float activityMod = 0.25;
+    uint32 GetEventValue(uint32 bot, RandomBotEvent event);
     uint32 GetEventValue(uint32 bot, std::string const event);
     std::string const GetEventData(uint32 bot, std::string const event);
+    uint32 SetEventValue(uint32 bot, RandomBotEvent event, uint32 value, uint32 validIn, std::string const data = "");
     uint32 SetEventValue(uint32 bot, std::string const event, uint32 value, uint32 validIn,
                          std::string const data = "");
+    void SetEventValidIn(uint32 bot, RandomBotEvent event, uint32 validIn);
+    // the helpers below expect eventLock to be held
+    uint32 GetEventValue(CachedEvent& e, bool expires);
+    RandomBotEvents& GetBotEvents(uint32 bot);
+    CachedEvent& GetCachedEvent(uint32 bot, std::string const event);
+    static void AddAutoJoinInstances(BattlegroundInfoMap& data);
+    void ApplyQueueChecks();
     void GetBots();
     std::vector<uint32> GetBgBots(uint32 bracket);
     time_t BgCheckTimer;
     time_t LfgCheckTimer;
     time_t PlayersCheckTimer;
     uint32 AddRandomBots();
+    void LoadBotCharacters();
     bool ProcessBot(uint32 bot);
     void ScheduleRandomize(uint32 bot, uint32 time);
     void RandomTeleport(Player* bot);
@@ -204,7 +305,32 @@ private:
     // std::map<uint32, std::vector<WorldLocation>> rpgLocsCache;
     std::map<uint32, std::map<uint32, std::vector<WorldLocation>>> rpgLocsCacheLevel;
     std::map<TeamId, std::map<BattlegroundTypeId, std::vector<uint32>>> BattleMastersCache;
-    std::map<uint32, std::map<std::string, CachedEvent>> eventCache;
+    // events are read and changed by actions on the map threads, the lock guards the cache and the journals
+    std::mutex eventLock;
+    std::map<uint32, RandomBotEvents> eventCache;
+    bool eventsLoaded;
+    // events changed since the last flush, swapped out by FlushEvents
+    std::set<std::pair<uint32, RandomBotEvent>> dirtyEvents;
+    // the same for events with generated names like trade discounts
+    std::set<std::pair<uint32, std::string>> dirtyNamedEvents;
+    time_t eventsFlushTime;
+    // characters of every random bot account by account, filled by an async query on the first AddRandomBots
+    std::map<uint32, std::vector<RandomBotCharacter>> botCharacters;
+    bool botCharactersLoading;
+    bool botCharactersLoaded;
+    QueryCallbackProcessor queryProcessor;
+    // start of the first login batch and the world update times since, until the login queue drains
+    uint32 populationStartTime;
+    uint32 populationLoginTime;
+    bool populationReported;
+    std::array<uint32, POPULATION_UPDATE_BUCKETS> populationUpdateTimes;
+    uint32 populationUpdates;
+    uint32 populationMaxUpdateTime;
+    // results of the queue checks, handed over from the task scheduler
+    std::mutex queueCheckLock;
+    std::shared_ptr<BattlegroundInfoMap> checkedBattlegroundData;
+    std::shared_ptr<std::map<TeamId, std::vector<uint32>>> checkedLfgDungeons;
+    uint32 checkedPlayersLevel;
     std::list<uint32> currentBots;
     uint32 bgBotsCount;
     uint32 playersLevel;
@@ -5,6 +5,7 @@
 
 #include "ServerFacade.h"
 
+#include "LineOfSightCache.h"
 #include "Playerbots.h"
 #include "TargetedMovementGenerator.h"
 
@@ -39,6 +40,54 @@ bool ServerFacade::IsDistanceGreaterOrEqualThan(float dist1, float dist2) { retu
 
 bool ServerFacade::IsDistanceLessOrEqualThan(float dist1, float dist2) { return !IsDistanceGreaterThan(dist1, dist2); }
 
+bool ServerFacade::IsWithinLOSInMap(WorldObject* wo, WorldObject* target)
+{
+    if (!wo->IsInMap(target))
+        return false;
+
+    float ox, oy, oz;
+    if (target->IsPlayer())
+    {
+        target->GetPosition(ox, oy, oz);
+        oz += target->GetCollisionHeight();
+    }
+    else
+        target->GetHitSpherePointFor(
+            {wo->GetPositionX(), wo->GetPositionY(), wo->GetPositionZ() + wo->GetCollisionHeight()}, ox, oy, oz);
+
+    float x, y, z;
+    if (wo->IsPlayer())
+    {
+        wo->GetPosition(x, y, z);
+        z += wo->GetCollisionHeight();
+    }
+    else
+        wo->GetHitSpherePointFor(
+            {target->GetPositionX(), target->GetPositionY(), target->GetPositionZ() + target->GetCollisionHeight()},
+            x, y, z);
+
+    return sLineOfSightCache->IsInLineOfSight(wo->GetMap(), x, y, z, ox, oy, oz, wo->GetPhaseMask());
+}
+
+bool ServerFacade::IsWithinLOS(WorldObject* wo, float x, float y, float z)
+{
+    if (!wo->IsInWorld())
+        return true;
+
+    z += wo->GetCollisionHeight();
+
+    float ox, oy, oz;
+    if (wo->IsPlayer())
+    {
+        wo->GetPosition(ox, oy, oz);
+        oz += wo->GetCollisionHeight();
+    }
+    else
+        wo->GetHitSpherePointFor({x, y, z}, ox, oy, oz);
+
+    return sLineOfSightCache->IsInLineOfSight(wo->GetMap(), ox, oy, oz, x, y, z, wo->GetPhaseMask());
+}
+
 void ServerFacade::SetFacingTo(Player* bot, WorldObject* wo, bool force)
 {
     float angle = bot->GetAngle(wo);
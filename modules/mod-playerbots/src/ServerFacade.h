@@ -32,6 +32,10 @@ public:
     bool IsDistanceGreaterOrEqualThan(float dist1, float dist2);
     bool IsDistanceLessOrEqualThan(float dist1, float dist2);
 
+    // WorldObject::IsWithinLOSInMap and IsWithinLOS, answered from the line of sight cache of the map
+    bool IsWithinLOSInMap(WorldObject* wo, WorldObject* target);
+    bool IsWithinLOS(WorldObject* wo, float x, float y, float z);
+
     void SetFacingTo(Player* bot, WorldObject* wo, bool force = false);
     Unit* GetChaseTarget(Unit* target);
 
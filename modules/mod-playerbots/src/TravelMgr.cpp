@@ -2283,6 +2283,28 @@ void TravelMgr::LoadQuestTravelTable()
         loc->addPoint(&point);
     }
 
+    // Static eligibility is checked once here, isActive only runs for destinations near the bot.
+    questGiverGrid.clear();
+    rpgNpcGrid.clear();
+    grindMobGrid.clear();
+
+    for (auto& dest : questGivers)
+        questGiverGrid.addDestination(dest);
+
+    for (auto& dest : rpgNpcs)
+    {
+        CreatureTemplate const* cInfo = dest->GetCreatureTemplate();
+        rpgNpcGrid.addDestination(dest, cInfo && (cInfo->npcflag & (UNIT_NPC_FLAG_VENDOR | UNIT_NPC_FLAG_REPAIR)) &&
+                                            sFactionTemplateStore.LookupEntry(cInfo->faction));
+    }
+
+    for (auto& dest : grindMobs)
+    {
+        CreatureTemplate const* cInfo = dest->GetCreatureTemplate();
+        grindMobGrid.addDestination(dest, cInfo && cInfo->mingold && sFactionTemplateStore.LookupEntry(cInfo->faction),
+                                    cInfo ? cInfo->maxlevel : 0);
+    }
+
     // Clear these logs files
     sPlayerbotAIConfig->openLog("zones.csv", "w");
     sPlayerbotAIConfig->openLog("creatures.csv", "w");
@@ -2298,10 +2320,16 @@ void TravelMgr::LoadQuestTravelTable()
     sPlayerbotAIConfig->openLog("unload_grid.csv", "w");
     sPlayerbotAIConfig->openLog("unload_obj.csv", "w");
 
+    uint32 nodeLoadTime = getMSTime();
+
     sTravelNodeMap->loadNodeStore();
 
     sTravelNodeMap->generateAll();
 
+    // compare with the query latencies of ".playerbots debug nodes"
+    LOG_INFO("playerbots", ">> Loaded and generated {} travel nodes in {} ms", sTravelNodeMap->getNodes().size(),
+             GetMSTimeDiffToNow(nodeLoadTime));
+
     /*
     bool fullNavPointReload = false;
     bool storeNavPointReload = true;
@@ -3895,7 +3923,7 @@ std::vector<TravelDestination*> TravelMgr::getQuestTravelDestinations(Player* bo
 
     if (!questId)
     {
-        for (auto& dest : questGivers)
+        for (auto& dest : questGiverGrid.getDestinations(botLocation, maxDistance, !ignoreInactive))
         {
             if (!ignoreInactive && !dest->isActive(bot))
                 continue;
@@ -3933,7 +3961,7 @@ std::vector<TravelDestination*> TravelMgr::getQuestTravelDestinations(Player* bo
     }
     else if (questId == -1)
     {
-        for (auto& dest : questGivers)
+        for (auto& dest : questGiverGrid.getDestinations(botLocation, maxDistance, !ignoreInactive))
         {
             if (!ignoreInactive && !dest->isActive(bot))
                 continue;
@@ -3994,7 +4022,7 @@ std::vector<TravelDestination*> TravelMgr::getRpgTravelDestinations(Player* bot,
 
     std::vector<TravelDestination*> retTravelLocations;
 
-    for (auto& dest : rpgNpcs)
+    for (auto& dest : rpgNpcGrid.getDestinations(botLocation, maxDistance, !ignoreInactive))
     {
         if (!ignoreInactive && !dest->isActive(bot))
             continue;
@@ -4039,7 +4067,9 @@ std::vector<TravelDestination*> TravelMgr::getGrindTravelDestinations(Player* bo
 
     std::vector<TravelDestination*> retTravelLocations;
 
-    for (auto& dest : grindMobs)
+    // isActive never accepts mobs above the bot or below 40% of its level
+    uint32 botLevel = bot->GetLevel();
+    for (auto& dest : grindMobGrid.getDestinations(botLocation, maxDistance, !ignoreInactive, botLevel * 2 / 5, botLevel))
     {
         if (!ignoreInactive && !dest->isActive(bot))
             continue;
@@ -4177,6 +4207,152 @@ float TravelMgr::fastMapTransDistance(WorldPosition start, WorldPosition end)
     return minDist;
 }
 
+float TravelMgr::minMapTransDistance(uint32 mapId, WorldPosition end)
+{
+    if (mapId == end.getMapId())
+        return 0.0f;
+
+    float minDist = 200000;
+
+    auto mapTransfers = mapTransfersMap.find({mapId, end.getMapId()});
+
+    if (mapTransfers == mapTransfersMap.end())
+        return minDist;
+
+    // start -> pointFrom is never negative, so only the part after the portal is left
+    for (auto& mapTrans : mapTransfers->second)
+    {
+        if (!mapTrans.isTo(end))
+            continue;
+
+        float dist = mapTrans.getPointTo()->distance(end);
+
+        if (dist < minDist)
+            minDist = dist;
+    }
+
+    return minDist;
+}
+
+#define TRAVEL_DESTINATION_GRID_SIZE 500.0f
+
+uint64 TravelDestinationGrid::getCellKey(int32 cellX, int32 cellY)
+{
+    return (uint64(uint32(cellX)) << 32) | uint32(cellY);
+}
+
+void TravelDestinationGrid::addDestination(TravelDestination* dest, bool eligible, uint32 level)
+{
+    uint32 index = entries.size();
+    entries.push_back({dest, eligible, level});
+
+    for (WorldPosition* point : dest->getPoints(true))
+    {
+        int32 cellX = int32(std::floor(point->getX() / TRAVEL_DESTINATION_GRID_SIZE));
+        int32 cellY = int32(std::floor(point->getY() / TRAVEL_DESTINATION_GRID_SIZE));
+
+        std::vector<uint32>& cell = cells[point->getMapId()][getCellKey(cellX, cellY)];
+        if (cell.empty() || cell.back() != index)
+            cell.push_back(index);
+
+        std::vector<uint32>& map = maps[point->getMapId()];
+        if (map.empty() || map.back() != index)
+            map.push_back(index);
+    }
+}
+
+void TravelDestinationGrid::clear()
+{
+    entries.clear();
+    cells.clear();
+    maps.clear();
+}
+
+std::vector<TravelDestination*> TravelDestinationGrid::getDestinations(WorldPosition pos, float range,
+                                                                       bool eligibleOnly, uint32 minLevel,
+                                                                       uint32 maxLevel)
+{
+    std::vector<uint32> found;
+
+    if (range <= 0)
+    {
+        found.resize(entries.size());
+        std::iota(found.begin(), found.end(), 0);
+    }
+    else
+    {
+        auto mapCells = cells.find(pos.getMapId());
+        if (mapCells != cells.end())
+        {
+            int32 minX = int32(std::floor((pos.getX() - range) / TRAVEL_DESTINATION_GRID_SIZE));
+            int32 maxX = int32(std::floor((pos.getX() + range) / TRAVEL_DESTINATION_GRID_SIZE));
+            int32 minY = int32(std::floor((pos.getY() - range) / TRAVEL_DESTINATION_GRID_SIZE));
+            int32 maxY = int32(std::floor((pos.getY() + range) / TRAVEL_DESTINATION_GRID_SIZE));
+
+            // A wide range looks at the occupied cells instead of every cell in the window.
+            if (uint64(maxX - minX + 1) * uint64(maxY - minY + 1) > mapCells->second.size())
+            {
+                for (auto& cell : mapCells->second)
+                {
+                    int32 cellX = int32(uint32(cell.first >> 32));
+                    int32 cellY = int32(uint32(cell.first));
+
+                    if (cellX >= minX && cellX <= maxX && cellY >= minY && cellY <= maxY)
+                        found.insert(found.end(), cell.second.begin(), cell.second.end());
+                }
+            }
+            else
+            {
+                for (int32 cellX = minX; cellX <= maxX; ++cellX)
+                {
+                    for (int32 cellY = minY; cellY <= maxY; ++cellY)
+                    {
+                        auto cell = mapCells->second.find(getCellKey(cellX, cellY));
+                        if (cell != mapCells->second.end())
+                            found.insert(found.end(), cell->second.begin(), cell->second.end());
+                    }
+                }
+            }
+        }
+
+        // Points on other maps are only in range through a map transfer that ends in range.
+        for (auto& map : maps)
+        {
+            if (map.first == pos.getMapId())
+                continue;
+
+            if (sTravelMgr->minMapTransDistance(map.first, pos) > range)
+                continue;
+
+            found.insert(found.end(), map.second.begin(), map.second.end());
+        }
+
+        std::sort(found.begin(), found.end());
+        found.erase(std::unique(found.begin(), found.end()), found.end());
+    }
+
+    std::vector<TravelDestination*> dests;
+    dests.reserve(found.size());
+
+    for (uint32 index : found)
+    {
+        Entry const& entry = entries[index];
+
+        if (eligibleOnly)
+        {
+            if (!entry.eligible)
+                continue;
+
+            if (entry.level && maxLevel && (entry.level < minLevel || entry.level > maxLevel))
+                continue;
+        }
+
+        dests.push_back(entry.dest);
+    }
+
+    return dests;
+}
+
 QuestTravelDestination::QuestTravelDestination(uint32 questId1, float radiusMin1, float radiusMax1)
     : TravelDestination(radiusMin1, radiusMax1)
 {
@@ -841,6 +841,33 @@ protected:
     WorldPosition* wPosition = nullptr;
 };
 
+// Destinations of one catalog bucketed by map and coarse x/y cell, queries return them in catalog order.
+class TravelDestinationGrid
+{
+public:
+    // Destinations that are not eligible or outside the level band of a query are never active for it.
+    void addDestination(TravelDestination* dest, bool eligible = true, uint32 level = 0);
+    void clear();
+
+    // Destinations that can be within range of pos, range <= 0 returns the whole catalog.
+    std::vector<TravelDestination*> getDestinations(WorldPosition pos, float range, bool eligibleOnly = false,
+                                                    uint32 minLevel = 0, uint32 maxLevel = 0);
+
+private:
+    struct Entry
+    {
+        TravelDestination* dest;
+        bool eligible;
+        uint32 level;
+    };
+
+    static uint64 getCellKey(int32 cellX, int32 cellY);
+
+    std::vector<Entry> entries;
+    std::unordered_map<uint32, std::unordered_map<uint64, std::vector<uint32>>> cells;
+    std::unordered_map<uint32, std::vector<uint32>> maps;
+};
+
 // General container for all travel destinations.
 class TravelMgr
 {
@@ -898,6 +925,8 @@ public:
     void loadMapTransfers();
     float mapTransDistance(WorldPosition start, WorldPosition end);
     float fastMapTransDistance(WorldPosition start, WorldPosition end);
+    // Lower bound of mapTransDistance from any point of a map to end.
+    float minMapTransDistance(uint32 mapId, WorldPosition end);
 
     NullTravelDestination* nullTravelDestination = new NullTravelDestination();
     WorldPosition* nullWorldPosition = new WorldPosition();
@@ -929,6 +958,10 @@ public:
     std::vector<GrindTravelDestination*> grindMobs;
     std::vector<BossTravelDestination*> bossMobs;
 
+    TravelDestinationGrid questGiverGrid;
+    TravelDestinationGrid rpgNpcGrid;
+    TravelDestinationGrid grindMobGrid;
+
     std::unordered_map<uint32, ExploreTravelDestination*> exploreLocs;
     std::unordered_map<uint32, QuestContainer*> quests;
 
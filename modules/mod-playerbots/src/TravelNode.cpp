@@ -6,6 +6,7 @@
 #include "TravelNode.h"
 
 #include <iomanip>
+#include <mutex>
 #include <regex>
 
 #include "BudgetValues.h"
@@ -14,6 +15,12 @@
 #include "ServerFacade.h"
 #include "TransportMgr.h"
 
+// Landmarks per graph, walk links are weighted with the landmark speed so the bounds stay below the cost for
+// bots that run slower than a mounted bot.
+#define TRAVEL_NODE_LANDMARKS 16
+#define TRAVEL_NODE_LANDMARK_SPEED 14.0f
+#define TRAVEL_NODE_UNREACHABLE std::numeric_limits<float>::max()
+
 // TravelNodePath(float distance = 0.1f, float extraCost = 0, TravelNodePathType pathType = TravelNodePathType::walk,
 // uint32 pathObject = 0, bool calculated = false, std::vector<uint8> maxLevelCreature = { 0,0,0 }, float swimDistance =
 // 0)
@@ -306,6 +313,33 @@ TravelNodePath* TravelNode::buildPath(TravelNode* endNode, Unit* bot, bool postP
     return returnNodePath;
 }
 
+static std::mutex searchIdLock;
+static uint32 searchIdCount = 0;
+static std::vector<uint32> freeSearchIds;
+
+uint32 TravelNode::AllocateSearchId()
+{
+    std::lock_guard<std::mutex> guard(searchIdLock);
+    if (freeSearchIds.empty())
+        return searchIdCount++;
+
+    uint32 id = freeSearchIds.back();
+    freeSearchIds.pop_back();
+    return id;
+}
+
+void TravelNode::ReleaseSearchId(uint32 id)
+{
+    std::lock_guard<std::mutex> guard(searchIdLock);
+    freeSearchIds.push_back(id);
+}
+
+uint32 TravelNode::getSearchIdCount()
+{
+    std::lock_guard<std::mutex> guard(searchIdLock);
+    return searchIdCount;
+}
+
 // Generic routine to remove references to nodes.
 void TravelNode::removeLinkTo(TravelNode* node, bool removePaths)
 {
@@ -1055,6 +1089,7 @@ TravelNodeMap::TravelNodeMap(TravelNodeMap* baseMap)
         newNode = new TravelNode(node);
 
         m_nodes.push_back(newNode);
+        addToGrid(newNode);
     }
 
     for (auto& node : baseMap->getNodes())
@@ -1106,6 +1141,7 @@ TravelNode* TravelNodeMap::addNode(WorldPosition pos, std::string const prefered
     newNode = new TravelNode(pos, finalName, isImportant);
 
     m_nodes.push_back(newNode);
+    addToGrid(newNode);
 
     return newNode;
 }
@@ -1114,10 +1150,22 @@ void TravelNodeMap::removeNode(TravelNode* node)
 {
     node->removeLinkTo(nullptr, true);
 
+    // The search id is handed to the next new node, which must not inherit the bounds of this one.
+    uint32 id = node->getSearchId();
+    for (uint32 i = 0; i < m_landmarkFrom.size(); ++i)
+    {
+        if (id < m_landmarkFrom[i].size())
+            m_landmarkFrom[i][id] = TRAVEL_NODE_UNREACHABLE;
+
+        if (id < m_landmarkTo[i].size())
+            m_landmarkTo[i][id] = TRAVEL_NODE_UNREACHABLE;
+    }
+
     for (auto& tnode : m_nodes)
     {
         if (tnode == node)
         {
+            removeFromGrid(tnode);
             delete tnode;
             tnode = nullptr;
         }
@@ -1146,22 +1194,152 @@ void TravelNodeMap::fullLinkNode(TravelNode* startNode, Unit* bot)
     startNode->setLinked(true);
 }
 
-std::vector<TravelNode*> TravelNodeMap::getNodes(WorldPosition pos, float range)
+// Edge length of a cell of the node grid in yards.
+#define TRAVEL_NODE_GRID_SIZE 100.0f
+
+uint64 TravelNodeMap::getGridKey(int32 cellX, int32 cellY)
 {
-    std::vector<TravelNode*> retVec;
+    return (uint64(uint32(cellX)) << 32) | uint32(cellY);
+}
 
-    for (auto& node : m_nodes)
+void TravelNodeMap::addToGrid(TravelNode* node)
+{
+    int32 cellX = int32(std::floor(node->getX() / TRAVEL_NODE_GRID_SIZE));
+    int32 cellY = int32(std::floor(node->getY() / TRAVEL_NODE_GRID_SIZE));
+
+    m_nodeGrids[node->getMapId()][getGridKey(cellX, cellY)].push_back(node);
+    ++m_mapNodeCounts[node->getMapId()];
+}
+
+void TravelNodeMap::removeFromGrid(TravelNode* node)
+{
+    int32 cellX = int32(std::floor(node->getX() / TRAVEL_NODE_GRID_SIZE));
+    int32 cellY = int32(std::floor(node->getY() / TRAVEL_NODE_GRID_SIZE));
+
+    NodeGrid& grid = m_nodeGrids[node->getMapId()];
+    NodeGrid::iterator cell = grid.find(getGridKey(cellX, cellY));
+    if (cell == grid.end())
+        return;
+
+    std::vector<TravelNode*>::iterator itr = std::find(cell->second.begin(), cell->second.end(), node);
+    if (itr == cell->second.end())
+        return;
+
+    cell->second.erase(itr);
+    if (cell->second.empty())
+        grid.erase(cell);
+
+    --m_mapNodeCounts[node->getMapId()];
+}
+
+void TravelNodeMap::collectNodes(WorldPosition pos, float range, uint32 count,
+                                 std::vector<std::pair<float, TravelNode*>>& found)
+{
+    found.clear();
+
+    std::unordered_map<uint32, NodeGrid>::iterator gridItr = m_nodeGrids.find(pos.getMapId());
+    if (gridItr == m_nodeGrids.end())
+        return;
+
+    NodeGrid& grid = gridItr->second;
+    // callers only hold the shared lock, operator[] could insert
+    std::unordered_map<uint32, uint32>::const_iterator countItr = m_mapNodeCounts.find(pos.getMapId());
+    uint32 mapNodes = countItr != m_mapNodeCounts.end() ? countItr->second : 0;
+    if (grid.empty())
+        return;
+
+    auto visit = [&](std::vector<TravelNode*> const& nodes)
     {
-        if (node->getMapId() == pos.getMapId())
-            if (range == -1 || node->getDistance(pos) <= range)
-                retVec.push_back(node);
+        for (TravelNode* node : nodes)
+        {
+            float distance = node->getDistance(pos);
+            if (range == -1 || distance <= range)
+                found.push_back(std::make_pair(distance, node));
+        }
+    };
+
+    int32 centerX = int32(std::floor(pos.getX() / TRAVEL_NODE_GRID_SIZE));
+    int32 centerY = int32(std::floor(pos.getY() / TRAVEL_NODE_GRID_SIZE));
+    int32 maxRing = range == -1 ? -1 : int32(std::ceil(range / TRAVEL_NODE_GRID_SIZE));
+
+    // a wide range touches more cells than the map has nodes, walking the buckets directly is cheaper then
+    if (maxRing == -1 ? count == 0 : uint64(2 * maxRing + 1) * (2 * maxRing + 1) > grid.size())
+    {
+        for (auto const& cell : grid)
+            visit(cell.second);
+
+        return;
     }
 
-    std::sort(retVec.begin(), retVec.end(),
-              [pos](TravelNode* i, TravelNode* j)
-              { return i->getPosition()->distance(pos) < j->getPosition()->distance(pos); });
+    uint32 visited = 0;
+    uint32 cells = 0;
+    for (int32 ring = 0; maxRing == -1 || ring <= maxRing; ++ring)
+    {
+        // the nearest nodes are far away from a sparse map, finish with a walk over the buckets
+        if (cells > 2 * grid.size())
+        {
+            found.clear();
+            for (auto const& cell : grid)
+                visit(cell.second);
+
+            return;
+        }
 
-    return std::move(retVec);
+        for (int32 x = centerX - ring; x <= centerX + ring; ++x)
+        {
+            // only the border of the ring, the inner cells were visited before
+            int32 step = (x == centerX - ring || x == centerX + ring) ? 1 : std::max(1, 2 * ring);
+            for (int32 y = centerY - ring; y <= centerY + ring; y += step)
+            {
+                ++cells;
+                NodeGrid::iterator cell = grid.find(getGridKey(x, y));
+                if (cell == grid.end())
+                    continue;
+
+                visited += cell->second.size();
+                visit(cell->second);
+            }
+        }
+
+        if (visited >= mapNodes)
+            break;
+
+        // every node outside the visited rings is further away than the ring border
+        if (count && found.size() >= count)
+        {
+            std::nth_element(found.begin(), found.begin() + (count - 1), found.end());
+            if (found[count - 1].first <= ring * TRAVEL_NODE_GRID_SIZE)
+                break;
+        }
+    }
+}
+
+void TravelNodeMap::getNearestNodes(WorldPosition pos, float range, uint32 count, std::vector<TravelNode*>& nodes)
+{
+    static thread_local std::vector<std::pair<float, TravelNode*>> found;
+    collectNodes(pos, range, count, found);
+
+    uint32 size = std::min<uint32>(count, found.size());
+    std::partial_sort(found.begin(), found.begin() + size, found.end());
+
+    nodes.clear();
+    for (uint32 i = 0; i < size; ++i)
+        nodes.push_back(found[i].second);
+}
+
+std::vector<TravelNode*> TravelNodeMap::getNodes(WorldPosition pos, float range)
+{
+    std::vector<std::pair<float, TravelNode*>> found;
+    collectNodes(pos, range, 0, found);
+
+    std::sort(found.begin(), found.end());
+
+    std::vector<TravelNode*> retVec;
+    retVec.reserve(found.size());
+    for (auto const& node : found)
+        retVec.push_back(node.second);
+
+    return retVec;
 }
 
 TravelNode* TravelNodeMap::getNode(WorldPosition pos, [[maybe_unused]] std::vector<WorldPosition>& ppath, Unit* bot,
@@ -1176,7 +1354,8 @@ TravelNode* TravelNodeMap::getNode(WorldPosition pos, [[maybe_unused]] std::vect
 
     uint32 c = 0;
 
-    std::vector<TravelNode*> nodes = sTravelNodeMap->getNodes(pos, range);
+    std::vector<TravelNode*> nodes;
+    sTravelNodeMap->getNearestNodes(pos, range, 6, nodes);
     for (auto& node : nodes)
     {
         if (!bot || pos.canPathTo(*node->getPosition(), bot))
@@ -1191,6 +1370,123 @@ TravelNode* TravelNodeMap::getNode(WorldPosition pos, [[maybe_unused]] std::vect
     return nullptr;
 }
 
+// A* state reused by all route searches of a thread, stubs are indexed by the search id of their node.
+class TravelNodeSearch
+{
+public:
+    void Begin()
+    {
+        if (!++generation)
+        {
+            std::fill(generations.begin(), generations.end(), 0);
+            generation = 1;
+        }
+
+        // stubs are referenced by pointer during the search, so the arena only grows here
+        uint32 count = TravelNode::getSearchIdCount();
+        if (stubs.size() < count)
+        {
+            stubs.resize(count, TravelNodeStub(nullptr));
+            generations.resize(count, 0);
+        }
+
+        open.clear();
+    }
+
+    TravelNodeStub* GetStub(TravelNode* node)
+    {
+        uint32 id = node->getSearchId();
+        if (id >= stubs.size())
+            return nullptr;
+
+        if (generations[id] != generation)
+        {
+            stubs[id] = TravelNodeStub(node);
+            generations[id] = generation;
+        }
+
+        return &stubs[id];
+    }
+
+    bool Empty() { return open.empty(); }
+
+    void Push(TravelNodeStub* stub)
+    {
+        stub->open = true;
+        stub->heapIndex = open.size();
+        open.push_back(stub);
+        SiftUp(stub->heapIndex);
+    }
+
+    // Restores the heap after the f of an open stub decreased.
+    void Update(TravelNodeStub* stub) { SiftUp(stub->heapIndex); }
+
+    TravelNodeStub* Pop()
+    {
+        TravelNodeStub* top = open.front();
+        TravelNodeStub* last = open.back();
+        open.pop_back();
+
+        if (top != last)
+        {
+            open[0] = last;
+            last->heapIndex = 0;
+            SiftDown(0);
+        }
+
+        top->open = false;
+        return top;
+    }
+
+private:
+    void Swap(uint32 left, uint32 right)
+    {
+        std::swap(open[left], open[right]);
+        open[left]->heapIndex = left;
+        open[right]->heapIndex = right;
+    }
+
+    void SiftUp(uint32 index)
+    {
+        while (index > 0)
+        {
+            uint32 parent = (index - 1) / 2;
+            if (open[parent]->m_f <= open[index]->m_f)
+                break;
+
+            Swap(index, parent);
+            index = parent;
+        }
+    }
+
+    void SiftDown(uint32 index)
+    {
+        while (true)
+        {
+            uint32 smallest = index;
+            uint32 left = index * 2 + 1;
+            uint32 right = left + 1;
+
+            if (left < open.size() && open[left]->m_f < open[smallest]->m_f)
+                smallest = left;
+
+            if (right < open.size() && open[right]->m_f < open[smallest]->m_f)
+                smallest = right;
+
+            if (smallest == index)
+                break;
+
+            Swap(index, smallest);
+            index = smallest;
+        }
+    }
+
+    std::vector<TravelNodeStub> stubs;
+    std::vector<uint32> generations;
+    std::vector<TravelNodeStub*> open;
+    uint32 generation = 0;
+};
+
 TravelNodeRoute TravelNodeMap::getRoute(TravelNode* start, TravelNode* goal, Player* bot)
 {
     float botSpeed = bot ? bot->GetSpeed(MOVE_RUN) : 7.0f;
@@ -1199,17 +1495,8 @@ TravelNodeRoute TravelNodeMap::getRoute(TravelNode* start, TravelNode* goal, Pla
         return TravelNodeRoute();
 
     // Basic A* algoritm
-    std::unordered_map<TravelNode*, TravelNodeStub> m_stubs;
-
-    TravelNodeStub* startStub = &m_stubs.insert(std::make_pair(start, TravelNodeStub(start))).first->second;
-
-    TravelNodeStub* currentNode = nullptr;
-    TravelNodeStub* childNode = nullptr;
-    float f = 0.f;
-    float g = 0.f;
-    float h = 0.f;
-
-    std::vector<TravelNodeStub*> open, closed;
+    uint32 startGold = 0;
+    PortalNode* portNode = nullptr;
 
     if (bot)
     {
@@ -1217,15 +1504,15 @@ TravelNodeRoute TravelNodeMap::getRoute(TravelNode* start, TravelNode* goal, Pla
         if (botAI)
         {
             if (botAI->HasCheat(BotCheatMask::gold))
-                startStub->currentGold = 10000000;
+                startGold = 10000000;
             else
             {
                 AiObjectContext* context = botAI->GetAiObjectContext();
-                startStub->currentGold = AI_VALUE2(uint32, "free money for", (uint32)NeedMoneyFor::travel);
+                startGold = AI_VALUE2(uint32, "free money for", (uint32)NeedMoneyFor::travel);
             }
         }
         else
-            startStub->currentGold = bot->GetMoney();
+            startGold = bot->GetMoney();
 
         if (!bot->HasSpellCooldown(8690) && bot->IsAlive())
         {
@@ -1234,7 +1521,8 @@ TravelNodeRoute TravelNodeMap::getRoute(TravelNode* start, TravelNode* goal, Pla
             TravelNode* homeNode = sTravelNodeMap->getNode(AI_VALUE(WorldPosition, "home bind"), nullptr, 10.0f);
             if (homeNode)
             {
-                PortalNode* portNode = (PortalNode*)sTravelNodeMap->teleportNodes[bot->GetGUID()][8690];
+                portNode = (PortalNode*)sTravelNodeMap->teleportNodes[bot->GetGUID()][8690];
+                if (!portNode)
                 {
                     portNode = new PortalNode(start);
 
@@ -1242,43 +1530,47 @@ TravelNodeRoute TravelNodeMap::getRoute(TravelNode* start, TravelNode* goal, Pla
                 }
 
                 portNode->SetPortal(start, homeNode, 8690);
-
-                childNode = &m_stubs.insert(std::make_pair(portNode, TravelNodeStub(portNode))).first->second;
-
-                childNode->m_g = 10 * MINUTE;
-                childNode->m_h = childNode->dataNode->fDist(goal) / botSpeed;
-                childNode->m_f = childNode->m_g + childNode->m_h;
-                // childNode->parent = startStub;
-
-                open.push_back(childNode);
-                std::push_heap(open.begin(), open.end(),
-                               [](TravelNodeStub* i, TravelNodeStub* j) { return i->m_f < j->m_f; });
-                childNode->open = true;
             }
         }
     }
 
-    if (open.size() == 0 && !start->hasRouteTo(goal))
+    if (!portNode && !start->hasRouteTo(goal))
         return TravelNodeRoute();
 
-    std::make_heap(open.begin(), open.end(), [](TravelNodeStub* i, TravelNodeStub* j) { return i->m_f < j->m_f; });
+    static thread_local TravelNodeSearch search;
+    search.Begin();
 
-    open.push_back(startStub);
-    std::push_heap(open.begin(), open.end(), [](TravelNodeStub* i, TravelNodeStub* j) { return i->m_f < j->m_f; });
-    startStub->open = true;
+    TravelNodeStub* startStub = search.GetStub(start);
+    if (!startStub)
+        return TravelNodeRoute();
 
-    while (!open.empty())
+    startStub->currentGold = startGold;
+
+    TravelNodeStub* currentNode = nullptr;
+    TravelNodeStub* childNode = nullptr;
+    float f = 0.f;
+    float g = 0.f;
+    float h = 0.f;
+    // faster bots than the landmark speed can beat the walk part of the landmark bounds
+    float landmarkScale = std::min(1.0f, TRAVEL_NODE_LANDMARK_SPEED / botSpeed);
+
+    if (portNode && (childNode = search.GetStub(portNode)))
     {
-        std::sort(open.begin(), open.end(), [](TravelNodeStub* i, TravelNodeStub* j) { return i->m_f < j->m_f; });
+        childNode->m_g = 10 * MINUTE;
+        childNode->m_h = std::max(childNode->dataNode->fDist(goal) / botSpeed,
+                                  getLandmarkCost(childNode->dataNode, goal) * landmarkScale);
+        childNode->m_f = childNode->m_g + childNode->m_h;
+        // childNode->parent = startStub;
 
-        currentNode = open.front();  // pop n node from open for which f is minimal
+        search.Push(childNode);
+    }
 
-        std::pop_heap(open.begin(), open.end(), [](TravelNodeStub* i, TravelNodeStub* j) { return i->m_f < j->m_f; });
-        open.pop_back();
-        currentNode->open = false;
+    search.Push(startStub);
 
+    while (!search.Empty())
+    {
+        currentNode = search.Pop();  // pop n node from open for which f is minimal
         currentNode->close = true;
-        closed.push_back(currentNode);
 
         if (currentNode->dataNode == goal ||
             (currentNode->dataNode->getMapId() != start->getMapId() && currentNode->dataNode->isWalking()))
@@ -1307,13 +1599,17 @@ TravelNodeRoute TravelNodeMap::getRoute(TravelNode* start, TravelNode* goal, Pla
             if (linkCost <= 0)
                 continue;
 
-            childNode = &m_stubs.insert(std::make_pair(linkNode, TravelNodeStub(linkNode))).first->second;
+            childNode = search.GetStub(linkNode);
+            if (!childNode)
+                continue;
+
             g = currentNode->m_g + linkCost;  // stance from start + distance between the two nodes
             if ((childNode->open || childNode->close) &&
                 childNode->m_g <= g)  // n' is already in opend or closed with a lower cost g(n')
                 continue;             // consider next successor
 
-            h = childNode->dataNode->fDist(goal) / botSpeed;
+            h = std::max(childNode->dataNode->fDist(goal) / botSpeed,
+                         getLandmarkCost(childNode->dataNode, goal) * landmarkScale);
             f = g + h;  // compute f(n')
             childNode->m_f = f;
             childNode->m_g = g;
@@ -1326,13 +1622,10 @@ TravelNodeRoute TravelNodeMap::getRoute(TravelNode* start, TravelNode* goal, Pla
             if (childNode->close)
                 childNode->close = false;
 
-            if (!childNode->open)
-            {
-                open.push_back(childNode);
-                std::push_heap(open.begin(), open.end(),
-                               [](TravelNodeStub* i, TravelNodeStub* j) { return i->m_f < j->m_f; });
-                childNode->open = true;
-            }
+            if (childNode->open)
+                search.Update(childNode);
+            else
+                search.Push(childNode);
         }
     }
 
@@ -1399,6 +1692,7 @@ TravelNodeRoute TravelNodeMap::getRoute(WorldPosition startPos, WorldPosition en
     {
         startPath.clear();
         TravelNode* botNode = sTravelNodeMap->teleportNodes[bot->GetGUID()][0];
+        if (!botNode)
         {
             botNode = new TravelNode(startPos, "Bot Pos", false);
             sTravelNodeMap->teleportNodes[bot->GetGUID()][0] = botNode;
@@ -2192,6 +2486,225 @@ void TravelNodeMap::generateAll()
         hasToFullGen = false;
         hasToSave = true;
     }
+
+    LOG_INFO("playerbots", "-Calculating landmarks");
+    calculateLandmarks();
+}
+
+typedef std::vector<std::vector<std::pair<uint32, float>>> LandmarkGraph;
+
+static void calculateLandmarkCosts(LandmarkGraph const& graph, uint32 source, std::vector<float>& costs)
+{
+    costs.assign(graph.size(), TRAVEL_NODE_UNREACHABLE);
+    costs[source] = 0.0f;
+
+    std::priority_queue<std::pair<float, uint32>, std::vector<std::pair<float, uint32>>,
+                        std::greater<std::pair<float, uint32>>>
+        open;
+    open.push(std::make_pair(0.0f, source));
+
+    while (!open.empty())
+    {
+        std::pair<float, uint32> current = open.top();
+        open.pop();
+
+        if (current.first > costs[current.second])
+            continue;
+
+        for (std::pair<uint32, float> const& link : graph[current.second])
+        {
+            float cost = current.first + link.second;
+            if (cost >= costs[link.first])
+                continue;
+
+            costs[link.first] = cost;
+            open.push(std::make_pair(cost, link.first));
+        }
+    }
+}
+
+void TravelNodeMap::calculateLandmarks()
+{
+    uint32 oldMSTime = getMSTime();
+
+    m_landmarkFrom.clear();
+    m_landmarkTo.clear();
+
+    if (m_nodes.empty())
+        return;
+
+    // Every usable link at its cheapest, flight paths are taken as known and paid for.
+    uint32 size = TravelNode::getSearchIdCount();
+    LandmarkGraph forward(size), backward(size);
+    for (TravelNode* node : m_nodes)
+    {
+        for (auto& link : *node->getLinks())
+        {
+            TravelNodePath* path = link.second;
+            float cost = path->getPathType() == TravelNodePathType::walk
+                             ? path->getDistance() / TRAVEL_NODE_LANDMARK_SPEED
+                             : path->getExtraCost();
+
+            if (cost < 0.0f)
+                continue;
+
+            forward[node->getSearchId()].push_back(std::make_pair(link.first->getSearchId(), cost));
+            backward[link.first->getSearchId()].push_back(std::make_pair(node->getSearchId(), cost));
+        }
+    }
+
+    // Each next landmark is the node farthest from the landmarks chosen so far, nodes no landmark reaches come first.
+    std::vector<float> nearest(size, TRAVEL_NODE_UNREACHABLE);
+    uint32 landmark = m_nodes.front()->getSearchId();
+    for (uint32 i = 0; i < TRAVEL_NODE_LANDMARKS && i < m_nodes.size(); ++i)
+    {
+        m_landmarkFrom.emplace_back();
+        m_landmarkTo.emplace_back();
+        calculateLandmarkCosts(forward, landmark, m_landmarkFrom.back());
+        calculateLandmarkCosts(backward, landmark, m_landmarkTo.back());
+
+        float farthest = -1.0f;
+        for (TravelNode* node : m_nodes)
+        {
+            uint32 id = node->getSearchId();
+            nearest[id] = std::min(nearest[id], m_landmarkFrom.back()[id]);
+
+            // a node without links would only bound itself
+            if (nearest[id] > farthest && !node->getLinks()->empty())
+            {
+                farthest = nearest[id];
+                landmark = id;
+            }
+        }
+
+        if (farthest <= 0.0f)
+            break;
+    }
+
+    LOG_INFO("playerbots", ">> Calculated {} landmarks for {} nodes in {} ms", m_landmarkFrom.size(), m_nodes.size(),
+             GetMSTimeDiffToNow(oldMSTime));
+}
+
+float TravelNodeMap::getLandmarkCost(TravelNode* start, TravelNode* goal)
+{
+    uint32 startId = start->getSearchId();
+    uint32 goalId = goal->getSearchId();
+    float bound = 0.0f;
+
+    for (uint32 i = 0; i < m_landmarkFrom.size(); ++i)
+    {
+        std::vector<float> const& from = m_landmarkFrom[i];
+        std::vector<float> const& to = m_landmarkTo[i];
+
+        // Nodes added after the landmarks were calculated have no bounds.
+        if (startId >= from.size() || goalId >= from.size())
+            return bound;
+
+        // landmark -> start -> goal is never shorter than landmark -> goal
+        if (from[startId] != TRAVEL_NODE_UNREACHABLE && from[goalId] != TRAVEL_NODE_UNREACHABLE)
+            bound = std::max(bound, from[goalId] - from[startId]);
+
+        // start -> goal -> landmark is never shorter than start -> landmark
+        if (to[startId] != TRAVEL_NODE_UNREACHABLE && to[goalId] != TRAVEL_NODE_UNREACHABLE)
+            bound = std::max(bound, to[startId] - to[goalId]);
+    }
+
+    return bound;
+}
+
+void TravelNodeMap::benchmarkRoutes()
+{
+    std::shared_lock<std::shared_timed_mutex> guard(m_nMapMtx);
+
+    uint32 nodeCount = m_nodes.size();
+    if (nodeCount < 2)
+        return;
+
+    uint32 const queries = 1000;
+    uint32 searched = 0;
+    uint32 found = 0;
+    uint32 arenaBefore = TravelNode::getSearchIdCount();
+
+    auto started = std::chrono::steady_clock::now();
+    for (uint32 i = 0; i < queries; ++i)
+    {
+        // spread the pairs over the whole node list, the same pairs every run
+        TravelNode* start = m_nodes[uint64(i) * 7919 % nodeCount];
+        TravelNode* goal = m_nodes[uint64(i) * 104729 % nodeCount];
+        if (start == goal || !start->hasRouteTo(goal))
+            continue;
+
+        ++searched;
+        if (!getRoute(start, goal).isEmpty())
+            ++found;
+    }
+
+    uint64 elapsed =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - started).count();
+    LOG_INFO("playerbots", "Route benchmark: {} searches, {} routes found, {} ms total, {} us per search", searched,
+             found, elapsed / 1000, searched ? elapsed / searched : 0);
+    LOG_INFO("playerbots", "Route benchmark: {} nodes, search arena of {} stubs before and {} after", nodeCount,
+             arenaBefore, TravelNode::getSearchIdCount());
+}
+
+void TravelNodeMap::benchmarkNodeQueries()
+{
+    std::shared_lock<std::shared_timed_mutex> guard(m_nMapMtx);
+
+    uint32 nodeCount = m_nodes.size();
+    if (!nodeCount)
+        return;
+
+    uint32 const queries = 1000;
+    uint32 const count = 6;
+
+    for (float range : {-1.0f, 500.0f})
+    {
+        std::vector<std::vector<TravelNode*>> scanned(queries);
+        std::vector<TravelNode*> nearest;
+        uint32 different = 0;
+
+        auto started = std::chrono::steady_clock::now();
+        for (uint32 i = 0; i < queries; ++i)
+        {
+            WorldPosition pos = *m_nodes[uint64(i) * 7919 % nodeCount]->getPosition();
+            std::vector<TravelNode*>& nodes = scanned[i];
+            for (TravelNode* node : m_nodes)
+            {
+                if (node->getMapId() == pos.getMapId() && (range == -1 || node->getDistance(pos) <= range))
+                    nodes.push_back(node);
+            }
+
+            std::sort(nodes.begin(), nodes.end(), [pos](TravelNode* left, TravelNode* right)
+                      { return left->getPosition()->distance(pos) < right->getPosition()->distance(pos); });
+
+            if (nodes.size() > count)
+                nodes.resize(count);
+        }
+
+        uint64 scanElapsed =
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - started).count();
+
+        started = std::chrono::steady_clock::now();
+        for (uint32 i = 0; i < queries; ++i)
+        {
+            WorldPosition pos = *m_nodes[uint64(i) * 7919 % nodeCount]->getPosition();
+            getNearestNodes(pos, range, count, nearest);
+
+            // nodes at the same distance may come in another order
+            if (nearest.size() != scanned[i].size() ||
+                (!nearest.empty() && nearest.back()->getDistance(pos) != scanned[i].back()->getDistance(pos)))
+                ++different;
+        }
+
+        uint64 gridElapsed =
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - started).count();
+
+        LOG_INFO("playerbots",
+                 "Node query benchmark range {}: {} queries over {} nodes, scan {} us per query, grid {} us per query, "
+                 "{} results differ",
+                 range, queries, nodeCount, scanElapsed / queries, gridElapsed / queries, different);
+    }
 }
 
 void TravelNodeMap::printMap()
@@ -2401,6 +2914,7 @@ void TravelNodeMap::loadNodeStore()
     std::string const query = "SELECT id, name, map_id, x, y, z, linked FROM playerbots_travelnode";
 
     std::unordered_map<uint32, TravelNode*> saveNodes;
+    uint32 oldMSTime = getMSTime();
 
     {
         if (PreparedQueryResult result =
@@ -2423,7 +2937,7 @@ void TravelNodeMap::loadNodeStore()
 
             } while (result->NextRow());
 
-            LOG_INFO("playerbots", ">> Loaded {} travelNodes.", saveNodes.size());
+            LOG_INFO("playerbots", ">> Loaded {} travelNodes in {} ms", saveNodes.size(), GetMSTimeDiffToNow(oldMSTime));
         }
         else
         {
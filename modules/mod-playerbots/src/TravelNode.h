@@ -202,12 +202,20 @@ public:
         important = baseNode->important;
     }
 
+    virtual ~TravelNode() { ReleaseSearchId(searchId); }
+
+    // a copy would share the search id
+    TravelNode(TravelNode const&) = delete;
+    TravelNode& operator=(TravelNode const&) = delete;
+
     // Setters
     void setLinked(bool linked1) { linked = linked1; }
     void setPoint(WorldPosition point1) { point = point1; }
 
     // Getters
     std::string const getName() { return nodeName; };
+    uint32 getSearchId() { return searchId; }
+    static uint32 getSearchIdCount();
     WorldPosition* getPosition() { return &point; };
     std::unordered_map<TravelNode*, TravelNodePath>* getPaths() { return &paths; }
     std::unordered_map<TravelNode*, TravelNodePath*>* getLinks() { return &links; }
@@ -342,6 +350,14 @@ protected:
     // bool transport = false;
     // Entry of transport.
     // uint32 transportId = 0;
+
+    // Dense id of the node in the search arena of the route finder, ids of deleted nodes are handed out again
+    // so the arena stays as large as the most nodes alive at once.
+    uint32 searchId = AllocateSearchId();
+
+private:
+    static uint32 AllocateSearchId();
+    static void ReleaseSearchId(uint32 id);
 };
 
 class PortalNode : public TravelNode
@@ -471,6 +487,7 @@ public:
     bool open = false, close = false;
     TravelNodeStub* parent = nullptr;
     uint32 currentGold = 0;
+    uint32 heapIndex = 0;
 };
 
 // The container of all nodes.
@@ -508,6 +525,8 @@ public:
     // Get all nodes
     std::vector<TravelNode*> getNodes() { return m_nodes; }
     std::vector<TravelNode*> getNodes(WorldPosition pos, float range = -1);
+    // Fills nodes with the count nearest nodes within range ordered by distance, without copying the node list.
+    void getNearestNodes(WorldPosition pos, float range, uint32 count, std::vector<TravelNode*>& nodes);
 
     // Find nearest node.
     TravelNode* getNode(TravelNode* sameNode)
@@ -569,6 +588,15 @@ public:
 
     void generateAll();
 
+    // Distances from and to a set of landmark nodes, used as lower bounds of the travel time between nodes.
+    void calculateLandmarks();
+    float getLandmarkCost(TravelNode* start, TravelNode* goal);
+
+    // times route searches between pairs of connected nodes
+    void benchmarkRoutes();
+    // times the nearest node lookups of getNode against the scan over all nodes they replaced
+    void benchmarkNodeQueries();
+
     void printMap();
 
     void printNodeStore();
@@ -586,8 +614,25 @@ public:
     std::unordered_map<ObjectGuid, std::unordered_map<uint32, TravelNode*>> teleportNodes;
 
 private:
+    typedef std::unordered_map<uint64, std::vector<TravelNode*>> NodeGrid;
+
+    static uint64 getGridKey(int32 cellX, int32 cellY);
+    void addToGrid(TravelNode* node);
+    void removeFromGrid(TravelNode* node);
+    // Collects nodes within range of pos (no limit for -1) with their distance, visiting the grid cells in rings.
+    void collectNodes(WorldPosition pos, float range, uint32 count, std::vector<std::pair<float, TravelNode*>>& found);
+
     std::vector<TravelNode*> m_nodes;
 
+    // Nodes of each map bucketed by their x/y cell for range and nearest lookups.
+    std::unordered_map<uint32, NodeGrid> m_nodeGrids;
+    std::unordered_map<uint32, uint32> m_mapNodeCounts;
+
+    // Travel time (seconds at landmark speed) from each landmark to a node and from the node to the landmark,
+    // indexed by landmark and search id. Removed nodes are set unreachable, so a reused search id has no bounds.
+    std::vector<std::vector<float>> m_landmarkFrom;
+    std::vector<std::vector<float>> m_landmarkTo;
+
     std::vector<std::pair<uint32, WorldPosition>> mapOffsets;
 
     bool hasToSave = false;
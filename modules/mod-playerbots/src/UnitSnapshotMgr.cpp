@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, released under GNU GPL v2 license, you may redistribute it
+ * and/or modify it under version 2 of the License, or (at your option), any later version.
+ */
+
+#include "UnitSnapshotMgr.h"
+
+#include "CellImpl.h"
+#include "GameTime.h"
+#include "GridNotifiers.h"
+#include "Map.h"
+#include "ObjectAccessor.h"
+
+// units may move a little between the snapshot and the search within the same update
+#define UNIT_SNAPSHOT_MOVE_SLACK 5.0f
+// snapshots of maps nobody searched for this long are dropped
+#define UNIT_SNAPSHOT_EXPIRE_TIME 60000
+
+class CellUnitCollector
+{
+public:
+    CellUnitCollector(CellUnitSnapshot& cell) : cell(cell) {}
+
+    void Visit(PlayerMapType& m)
+    {
+        for (PlayerMapType::iterator itr = m.begin(); itr != m.end(); ++itr)
+            Add(itr->GetSource());
+    }
+
+    void Visit(CreatureMapType& m)
+    {
+        for (CreatureMapType::iterator itr = m.begin(); itr != m.end(); ++itr)
+            Add(itr->GetSource());
+    }
+
+    template <class NOT_INTERESTED>
+    void Visit(GridRefMgr<NOT_INTERESTED>&)
+    {
+    }
+
+private:
+    void Add(Unit* unit)
+    {
+        cell.guids.push_back(unit->GetGUID());
+        cell.x.push_back(unit->GetPositionX());
+        cell.y.push_back(unit->GetPositionY());
+        cell.sizes.push_back(unit->GetObjectSize());
+        cell.phaseMasks.push_back(unit->GetPhaseMask());
+    }
+
+    CellUnitSnapshot& cell;
+};
+
+void UnitSnapshotMgr::GetUnits(WorldObject* searcher, float range, std::vector<Unit*>& units)
+{
+    Map* map = searcher->FindMap();
+    if (!map)
+        return;
+
+    uint64 tick = GameTime::GetGameTimeMS().count();
+    std::shared_ptr<MapUnitSnapshot> snapshot = GetMapSnapshot(map, tick);
+
+    float x = searcher->GetPositionX();
+    float y = searcher->GetPositionY();
+    float radius = std::min<float>(range + searcher->GetCombatReach(), SIZE_OF_GRIDS);
+    CellArea area = Cell::CalculateCellArea(x, y, radius);
+
+    uint32 phaseMask = searcher->GetPhaseMask();
+    float reach = range + searcher->GetObjectSize() + UNIT_SNAPSHOT_MOVE_SLACK;
+
+    std::vector<ObjectGuid> guids;
+    {
+        std::lock_guard<std::mutex> guard(snapshot->lock);
+        snapshot->tick = tick;
+
+        for (uint32 cellX = area.low_bound.x_coord; cellX <= area.high_bound.x_coord; ++cellX)
+        {
+            for (uint32 cellY = area.low_bound.y_coord; cellY <= area.high_bound.y_coord; ++cellY)
+            {
+                CellUnitSnapshot& cell = snapshot->cells[cellX * TOTAL_NUMBER_OF_CELLS_PER_MAP + cellY];
+                if (cell.tick != tick)
+                    BuildCell(map, cellX, cellY, cell, tick);
+
+                for (uint32 i = 0; i < cell.guids.size(); ++i)
+                {
+                    if (!(cell.phaseMasks[i] & phaseMask))
+                        continue;
+
+                    float dx = cell.x[i] - x;
+                    float dy = cell.y[i] - y;
+                    float maxDist = reach + cell.sizes[i];
+                    if (dx * dx + dy * dy > maxDist * maxDist)
+                        continue;
+
+                    guids.push_back(cell.guids[i]);
+                }
+            }
+        }
+    }
+
+    // the snapshot only holds guids, units that left the map since are not found anymore
+    units.reserve(units.size() + guids.size());
+    for (ObjectGuid const& guid : guids)
+    {
+        Unit* unit = ObjectAccessor::GetUnit(*searcher, guid);
+        if (unit && unit->IsInWorld() && unit->FindMap() == map)
+            units.push_back(unit);
+    }
+}
+
+std::shared_ptr<MapUnitSnapshot> UnitSnapshotMgr::GetMapSnapshot(Map* map, uint64 tick)
+{
+    uint64 key = (uint64(map->GetId()) << 32) | map->GetInstanceId();
+
+    {
+        std::shared_lock<std::shared_mutex> guard(mapsLock);
+        auto itr = maps.find(key);
+        if (itr != maps.end())
+            return itr->second;
+    }
+
+    std::unique_lock<std::shared_mutex> guard(mapsLock);
+
+    // snapshots of unloaded instances are dropped while the lock is held for writing anyway
+    for (auto itr = maps.begin(); itr != maps.end();)
+    {
+        if (itr->first != key && itr->second->tick + UNIT_SNAPSHOT_EXPIRE_TIME < tick)
+            itr = maps.erase(itr);
+        else
+            ++itr;
+    }
+
+    std::shared_ptr<MapUnitSnapshot>& snapshot = maps[key];
+    if (!snapshot)
+    {
+        snapshot = std::make_shared<MapUnitSnapshot>();
+        snapshot->tick = tick;
+    }
+
+    return snapshot;
+}
+
+void UnitSnapshotMgr::BuildCell(Map* map, uint32 cellX, uint32 cellY, CellUnitSnapshot& cell, uint64 tick)
+{
+    cell.tick = tick;
+    cell.guids.clear();
+    cell.x.clear();
+    cell.y.clear();
+    cell.sizes.clear();
+    cell.phaseMasks.clear();
+
+    Cell gridCell(CellCoord(cellX, cellY));
+    gridCell.SetNoCreate();
+
+    CellUnitCollector collector(cell);
+    TypeContainerVisitor<CellUnitCollector, WorldTypeMapContainer> worldVisitor(collector);
+    map->Visit(gridCell, worldVisitor);
+    TypeContainerVisitor<CellUnitCollector, GridTypeMapContainer> gridVisitor(collector);
+    map->Visit(gridCell, gridVisitor);
+}
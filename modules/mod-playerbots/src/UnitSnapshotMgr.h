@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, released under GNU GPL v2 license, you may redistribute it
+ * and/or modify it under version 2 of the License, or (at your option), any later version.
+ */
+
+#ifndef _PLAYERBOT_UNITSNAPSHOTMGR_H
+#define _PLAYERBOT_UNITSNAPSHOTMGR_H
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "Common.h"
+#include "ObjectGuid.h"
+
+class Map;
+class Unit;
+class WorldObject;
+
+// Units of one grid cell as they were when the cell was first searched in the current tick.
+struct CellUnitSnapshot
+{
+    uint64 tick = 0;
+    std::vector<ObjectGuid> guids;
+    std::vector<float> x;
+    std::vector<float> y;
+    std::vector<float> sizes;
+    std::vector<uint32> phaseMasks;
+};
+
+struct MapUnitSnapshot
+{
+    std::mutex lock;
+    std::atomic<uint64> tick = 0;
+    std::unordered_map<uint32, CellUnitSnapshot> cells;
+};
+
+// Walks each grid cell at most once per map update for all bots searching units around them.
+class UnitSnapshotMgr
+{
+public:
+    UnitSnapshotMgr() {}
+    virtual ~UnitSnapshotMgr() {}
+    static UnitSnapshotMgr* instance()
+    {
+        static UnitSnapshotMgr instance;
+        return &instance;
+    }
+
+    // Units in the phase of the searcher from the cells Cell::VisitAllObjects would visit for range. They are only
+    // roughly in range, the caller still applies its own check.
+    void GetUnits(WorldObject* searcher, float range, std::vector<Unit*>& units);
+
+private:
+    std::shared_ptr<MapUnitSnapshot> GetMapSnapshot(Map* map, uint64 tick);
+    void BuildCell(Map* map, uint32 cellX, uint32 cellY, CellUnitSnapshot& cell, uint64 tick);
+
+    std::shared_mutex mapsLock;
+    // shared with the searches still using a snapshot when another map thread drops it
+    std::unordered_map<uint64, std::shared_ptr<MapUnitSnapshot>> maps;
+};
+
+#define sUnitSnapshotMgr UnitSnapshotMgr::instance()
+
+#endif
@@ -13,13 +13,18 @@
  * with this program. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include "AiFactory.h"
 #include "BattleGroundTactics.h"
 #include "Chat.h"
+#include "Engine.h"
 #include "GuildTaskMgr.h"
 #include "PerformanceMonitor.h"
 #include "PlayerbotMgr.h"
+#include "Playerbots.h"
+#include "RandomItemMgr.h"
 #include "RandomPlayerbotMgr.h"
 #include "ScriptMgr.h"
+#include "StatsWeightCalculator.h"
 
 using namespace Acore::ChatCommands;
 
@@ -32,12 +37,18 @@ public:
     {
         static ChatCommandTable playerbotsDebugCommandTable = {
             {"bg", HandleDebugBGCommand, SEC_GAMEMASTER, Console::Yes},
+            {"stats", HandleDebugStatsCommand, SEC_GAMEMASTER, Console::No},
+            {"contexts", HandleDebugContextsCommand, SEC_GAMEMASTER, Console::No},
+            {"queue", HandleDebugQueueCommand, SEC_GAMEMASTER, Console::Yes},
+            {"routes", HandleDebugRoutesCommand, SEC_GAMEMASTER, Console::Yes},
+            {"nodes", HandleDebugNodesCommand, SEC_GAMEMASTER, Console::Yes},
         };
         static ChatCommandTable playerbotsCommandTable = {
             {"bot", HandlePlayerbotCommand, SEC_PLAYER, Console::No},
             {"gtask", HandleGuildTaskCommand, SEC_GAMEMASTER, Console::Yes},
             {"pmon", HandlePerfMonCommand, SEC_GAMEMASTER, Console::Yes},
             {"rndbot", HandleRandomPlayerbotCommand, SEC_GAMEMASTER, Console::Yes},
+            {"rnditem", HandleRandomItemCommand, SEC_GAMEMASTER, Console::Yes},
             {"debug", playerbotsDebugCommandTable},
         };
 
@@ -58,6 +69,11 @@ public:
         return RandomPlayerbotMgr::HandlePlayerbotConsoleCommand(handler, args);
     }
 
+    static bool HandleRandomItemCommand(ChatHandler* handler, char const* args)
+    {
+        return RandomItemMgr::HandleConsoleCommand(handler, args);
+    }
+
     static bool HandleGuildTaskCommand(ChatHandler* handler, char const* args)
     {
         return GuildTaskMgr::HandleConsoleCommand(handler, args);
@@ -101,6 +117,79 @@ public:
     {
         return BGTactics::HandleConsoleCommand(handler, args);
     }
+
+    static bool HandleDebugStatsCommand(ChatHandler* handler, char const* args)
+    {
+        Player* player = handler->getSelectedPlayerOrSelf();
+        if (!player)
+            return false;
+
+        StatsWeightCalculator::Benchmark(player);
+        return true;
+    }
+
+    static bool HandleDebugContextsCommand(ChatHandler* handler, char const* args)
+    {
+        Player* player = handler->getSelectedPlayerOrSelf();
+        if (!player || !GET_PLAYERBOT_AI(player))
+        {
+            handler->PSendSysMessage("Select a bot");
+            return false;
+        }
+
+        // enough contexts by default that the resident memory grows by more than a few pages
+        uint32 count = 1000;
+        if (args && *args)
+            count = std::max(1, atoi(args));
+
+        AiFactory::BenchmarkContexts(player, count);
+        return true;
+    }
+
+    static bool HandleDebugQueueCommand(ChatHandler* handler, char const* /*args*/)
+    {
+        std::vector<QueueOperation> operations;
+        uint32 recorded = 0;
+        uint32 limit = 0;
+        if (Queue::TakeRecording(operations, recorded, limit))
+        {
+            Queue::Benchmark(operations);
+            handler->PSendSysMessage("Replayed {} recorded queue operations, see the server log", operations.size());
+            return true;
+        }
+
+        if (limit)
+        {
+            handler->PSendSysMessage("Recorded {} of {} queue operations", recorded, limit);
+            return true;
+        }
+
+        Player* player = handler->getSelectedPlayerOrSelf();
+        PlayerbotAI* botAI = player ? GET_PLAYERBOT_AI(player) : nullptr;
+        if (!botAI || !botAI->GetCurrentEngine())
+        {
+            handler->PSendSysMessage("Select a bot");
+            return false;
+        }
+
+        // the bot keeps playing, the command replays its queue once enough ticks were recorded
+        Queue::Record(&botAI->GetCurrentEngine()->GetQueue(), 20000);
+        handler->PSendSysMessage("Recording the action queue of {}, run the command again to replay it",
+                                 player->GetName());
+        return true;
+    }
+
+    static bool HandleDebugRoutesCommand(ChatHandler* /*handler*/, char const* /*args*/)
+    {
+        sTravelNodeMap->benchmarkRoutes();
+        return true;
+    }
+
+    static bool HandleDebugNodesCommand(ChatHandler* /*handler*/, char const* /*args*/)
+    {
+        sTravelNodeMap->benchmarkNodeQueries();
+        return true;
+    }
 };
 
 void AddSC_playerbots_commandscript() { new playerbots_commandscript(); }
@@ -50,6 +50,8 @@ std::list<uint32> PlayerbotFactory::classQuestIds;
 std::list<uint32> PlayerbotFactory::specialQuestIds;
 std::vector<uint32> PlayerbotFactory::enchantSpellIdCache;
 std::vector<uint32> PlayerbotFactory::enchantGemIdCache;
+std::unordered_map<uint32, std::shared_ptr<EquipmentCandidateList const>> PlayerbotFactory::equipmentCandidates;
+std::shared_mutex PlayerbotFactory::equipmentCandidatesLock;
 
 PlayerbotFactory::PlayerbotFactory(Player* bot, uint32 level, uint32 itemQuality, uint32 gearScoreLimit)
     : level(level), itemQuality(itemQuality), gearScoreLimit(gearScoreLimit), bot(bot)
@@ -68,6 +70,12 @@ PlayerbotFactory::PlayerbotFactory(Player* bot, uint32 level, uint32 itemQuality
 
 void PlayerbotFactory::Init()
 {
+    // gear limits may have changed with the config
+    {
+        std::unique_lock<std::shared_mutex> guard(equipmentCandidatesLock);
+        equipmentCandidates.clear();
+    }
+
     if (sPlayerbotAIConfig->randomBotPreQuests)
     {
         ObjectMgr::QuestMap const& questTemplates = sObjectMgr->GetQuestTemplates();
@@ -1190,25 +1198,29 @@ private:
     std::set<uint32> keep;
 };
 
-bool PlayerbotFactory::CanEquipArmor(ItemTemplate const* proto)
+uint32 PlayerbotFactory::GetArmorSkill(ItemTemplate const* proto)
 {
-    if (proto->SubClass == ITEM_SUBCLASS_ARMOR_PLATE && !bot->HasSkill(SKILL_PLATE_MAIL))
-    {
-        return false;
-    }
-    if (proto->SubClass == ITEM_SUBCLASS_ARMOR_MAIL && !bot->HasSkill(SKILL_MAIL))
-    {
-        return false;
-    }
-    if (proto->SubClass == ITEM_SUBCLASS_ARMOR_LEATHER && !bot->HasSkill(SKILL_LEATHER))
-    {
-        return false;
-    }
-    if (proto->SubClass == ITEM_SUBCLASS_ARMOR_CLOTH && !bot->HasSkill(SKILL_CLOTH))
+    switch (proto->SubClass)
     {
-        return false;
+        case ITEM_SUBCLASS_ARMOR_PLATE:
+            return SKILL_PLATE_MAIL;
+        case ITEM_SUBCLASS_ARMOR_MAIL:
+            return SKILL_MAIL;
+        case ITEM_SUBCLASS_ARMOR_LEATHER:
+            return SKILL_LEATHER;
+        case ITEM_SUBCLASS_ARMOR_CLOTH:
+            return SKILL_CLOTH;
+        case ITEM_SUBCLASS_ARMOR_SHIELD:
+            return SKILL_SHIELD;
+        default:
+            return 0;
     }
-    if (proto->SubClass == ITEM_SUBCLASS_ARMOR_SHIELD && !bot->HasSkill(SKILL_SHIELD))
+}
+
+bool PlayerbotFactory::CanEquipArmor(ItemTemplate const* proto)
+{
+    uint32 armorSkill = GetArmorSkill(proto);
+    if (armorSkill && !bot->HasSkill(armorSkill))
     {
         return false;
     }
@@ -1305,9 +1317,9 @@ void PlayerbotFactory::AddItemStats(uint32 mod, uint8& sp, uint8& ap, uint8& tan
     }
 }
 
-bool PlayerbotFactory::CanEquipWeapon(ItemTemplate const* proto)
+bool PlayerbotFactory::CanEquipWeapon(uint8 cls, ItemTemplate const* proto)
 {
-    switch (bot->getClass())
+    switch (cls)
     {
         case CLASS_PRIEST:
             if (proto->SubClass != ITEM_SUBCLASS_WEAPON_STAFF && proto->SubClass != ITEM_SUBCLASS_WEAPON_WAND &&
@@ -1547,21 +1559,6 @@ void PlayerbotFactory::InitEquipment(bool incremental, bool second_chance)
     std::unordered_map<uint8, std::vector<uint32>> items;
     // int tab = AiFactory::GetPlayerSpecTab(bot);
 
-    uint32 blevel = bot->GetLevel();
-    int32 delta = 2;
-    if (blevel < 15)
-        delta = std::min(blevel, 15u);
-    else if (blevel < 40)
-        delta = 10;
-    else if (blevel < 60)
-        delta = 6;
-    else if (blevel < 70)
-        delta = 9;
-    else if (blevel < 80)
-        delta = 9;
-    else if (blevel == 80)
-        delta = 9;
-
     StatsWeightCalculator calculator(bot);
     for (uint8 slot = 0; slot < EQUIPMENT_SLOT_END; ++slot)
     {
@@ -1596,71 +1593,34 @@ void PlayerbotFactory::InitEquipment(bool incremental, bool second_chance)
         }
         do
         {
-            for (uint32 requiredLevel = bot->GetLevel(); requiredLevel > std::max((int32)bot->GetLevel() - delta, 0);
-                 requiredLevel--)
+            std::shared_ptr<EquipmentCandidateList const> candidates =
+                GetEquipmentCandidates(bot->getClass(), bot->GetLevel(), slot, desiredQuality);
+            uint32 lastRequiredLevel = 0;
+            for (EquipmentCandidate const& candidate : *candidates)
             {
-                for (InventoryType inventoryType : GetPossibleInventoryTypeListBySlot((EquipmentSlots)slot))
+                // lower levels are only looked at while there are too few items
+                if (candidate.requiredLevel != lastRequiredLevel)
                 {
-                    for (uint32 itemId : sRandomItemMgr->GetCachedEquipments(requiredLevel, inventoryType))
-                    {
-                        if (itemId == 46978)  // shaman earth ring totem
-                        {
-                            continue;
-                        }
-                        uint32 skipProb = 25;
-                        if (urand(1, 100) <= skipProb)
-                            continue;
-
-                        // disable next expansion gear
-                        if (sPlayerbotAIConfig->limitGearExpansion && bot->GetLevel() <= 60 && itemId >= 23728)
-                            continue;
-
-                        if (sPlayerbotAIConfig->limitGearExpansion && bot->GetLevel() <= 70 && itemId >= 35570 &&
-                            itemId != 36737 && itemId != 37739 &&
-                            itemId != 37740)  // transition point from TBC -> WOTLK isn't as clear, and there are other
-                                              // wearable TBC items above 35570 but nothing of significance
-                            continue;
+                    if (items[slot].size() >= 25)
+                        break;
 
-                        ItemTemplate const* proto = sObjectMgr->GetItemTemplate(itemId);
-                        if (!proto)
-                            continue;
+                    lastRequiredLevel = candidate.requiredLevel;
+                }
 
-                        if (gearScoreLimit != 0 &&
-                            CalcMixedGearScore(proto->ItemLevel, proto->Quality) > gearScoreLimit)
-                        {
-                            continue;
-                        }
-                        if (proto->Class != ITEM_CLASS_WEAPON && proto->Class != ITEM_CLASS_ARMOR)
-                            continue;
+                uint32 skipProb = 25;
+                if (urand(1, 100) <= skipProb)
+                    continue;
 
-                        if (proto->Quality != desiredQuality)
-                            continue;
-                        // delay heavy check
-                        // if (!CanEquipItem(proto))
-                        //     continue;
-
-                        if (proto->Class == ITEM_CLASS_ARMOR &&
-                            (slot == EQUIPMENT_SLOT_HEAD || slot == EQUIPMENT_SLOT_SHOULDERS ||
-                             slot == EQUIPMENT_SLOT_CHEST || slot == EQUIPMENT_SLOT_WAIST ||
-                             slot == EQUIPMENT_SLOT_LEGS || slot == EQUIPMENT_SLOT_FEET ||
-                             slot == EQUIPMENT_SLOT_WRISTS || slot == EQUIPMENT_SLOT_HANDS) &&
-                            !CanEquipArmor(proto))
-                            continue;
+                if (gearScoreLimit != 0 && candidate.gearScore > gearScoreLimit)
+                    continue;
 
-                        if (proto->Class == ITEM_CLASS_WEAPON && !CanEquipWeapon(proto))
-                            continue;
+                if (candidate.armorSkill && !bot->HasSkill(candidate.armorSkill))
+                    continue;
 
-                        if (slot == EQUIPMENT_SLOT_OFFHAND && bot->getClass() == CLASS_ROGUE &&
-                            proto->Class != ITEM_CLASS_WEAPON)
-                            continue;
-                        // delay heavy check
-                        // uint16 dest = 0;
-                        // if (CanEquipUnseenItem(slot, dest, itemId))
-                        items[slot].push_back(itemId);
-                    }
-                }
-                if (items[slot].size() >= 25)
-                    break;
+                // delay heavy check
+                // uint16 dest = 0;
+                // if (CanEquipUnseenItem(slot, dest, itemId))
+                items[slot].push_back(candidate.itemId);
             }
         } while (items[slot].size() < 25 && desiredQuality-- > ITEM_QUALITY_NORMAL);
 
@@ -1670,6 +1630,9 @@ void PlayerbotFactory::InitEquipment(bool incremental, bool second_chance)
             continue;
         }
 
+        std::vector<float> scores;
+        calculator.CalculateItems(ids, scores);
+
         float bestScoreForSlot = -1;
         uint32 bestItemForSlot = 0;
         for (int index = 0; index < ids.size(); index++)
@@ -1678,7 +1641,7 @@ void PlayerbotFactory::InitEquipment(bool incremental, bool second_chance)
 
             ItemTemplate const* proto = sObjectMgr->GetItemTemplate(newItemId);
 
-            float cur_score = calculator.CalculateItem(newItemId);
+            float cur_score = scores[index];
             if (cur_score > bestScoreForSlot)
             {
                 // delay heavy check to here
@@ -1765,6 +1728,9 @@ void PlayerbotFactory::InitEquipment(bool incremental, bool second_chance)
             if (ids.empty())
                 continue;
 
+            std::vector<float> scores;
+            calculator.CalculateItems(ids, scores);
+
             float bestScoreForSlot = -1;
             uint32 bestItemForSlot = 0;
             for (int index = 0; index < ids.size(); index++)
@@ -1773,7 +1739,7 @@ void PlayerbotFactory::InitEquipment(bool incremental, bool second_chance)
 
                 ItemTemplate const* proto = sObjectMgr->GetItemTemplate(newItemId);
 
-                float cur_score = calculator.CalculateItem(newItemId);
+                float cur_score = scores[index];
                 if (cur_score > bestScoreForSlot)
                 {
                     // delay heavy check to here
@@ -1807,6 +1773,96 @@ void PlayerbotFactory::InitEquipment(bool incremental, bool second_chance)
     }
 }
 
+std::shared_ptr<EquipmentCandidateList const> PlayerbotFactory::GetEquipmentCandidates(uint8 cls, uint32 level,
+                                                                                    uint8 slot, uint32 quality)
+{
+    uint32 key = cls | (level << 8) | (uint32(slot) << 16) | (quality << 24);
+    {
+        std::shared_lock<std::shared_mutex> guard(equipmentCandidatesLock);
+        auto itr = equipmentCandidates.find(key);
+        if (itr != equipmentCandidates.end())
+            return itr->second;
+    }
+
+    // built unlocked, a bot doing the same at once only costs one list thrown away
+    std::shared_ptr<EquipmentCandidateList const> candidates = BuildEquipmentCandidates(cls, level, slot, quality);
+
+    std::unique_lock<std::shared_mutex> guard(equipmentCandidatesLock);
+    return equipmentCandidates.emplace(key, candidates).first->second;
+}
+
+std::shared_ptr<EquipmentCandidateList const> PlayerbotFactory::BuildEquipmentCandidates(uint8 cls, uint32 level,
+                                                                                      uint8 slot, uint32 quality)
+{
+    int32 delta = 2;
+    if (level < 15)
+        delta = std::min(level, 15u);
+    else if (level < 40)
+        delta = 10;
+    else if (level < 60)
+        delta = 6;
+    else if (level < 70)
+        delta = 9;
+    else if (level < 80)
+        delta = 9;
+    else if (level == 80)
+        delta = 9;
+
+    std::shared_ptr<EquipmentCandidateList> candidates = std::make_shared<EquipmentCandidateList>();
+    for (uint32 requiredLevel = level; requiredLevel > std::max((int32)level - delta, 0); requiredLevel--)
+    {
+        for (InventoryType inventoryType : GetPossibleInventoryTypeListBySlot((EquipmentSlots)slot))
+        {
+            for (uint32 itemId : sRandomItemMgr->GetCachedEquipments(requiredLevel, inventoryType))
+            {
+                if (itemId == 46978)  // shaman earth ring totem
+                {
+                    continue;
+                }
+
+                // disable next expansion gear
+                if (sPlayerbotAIConfig->limitGearExpansion && level <= 60 && itemId >= 23728)
+                    continue;
+
+                if (sPlayerbotAIConfig->limitGearExpansion && level <= 70 && itemId >= 35570 && itemId != 36737 &&
+                    itemId != 37739 &&
+                    itemId != 37740)  // transition point from TBC -> WOTLK isn't as clear, and there are other
+                                      // wearable TBC items above 35570 but nothing of significance
+                    continue;
+
+                ItemTemplate const* proto = sObjectMgr->GetItemTemplate(itemId);
+                if (!proto)
+                    continue;
+
+                if (proto->Class != ITEM_CLASS_WEAPON && proto->Class != ITEM_CLASS_ARMOR)
+                    continue;
+
+                if (proto->Quality != quality)
+                    continue;
+
+                // worn armor depends on the skills of the bot, checked when the list is used
+                uint32 armorSkill = 0;
+                if (proto->Class == ITEM_CLASS_ARMOR &&
+                    (slot == EQUIPMENT_SLOT_HEAD || slot == EQUIPMENT_SLOT_SHOULDERS || slot == EQUIPMENT_SLOT_CHEST ||
+                     slot == EQUIPMENT_SLOT_WAIST || slot == EQUIPMENT_SLOT_LEGS || slot == EQUIPMENT_SLOT_FEET ||
+                     slot == EQUIPMENT_SLOT_WRISTS || slot == EQUIPMENT_SLOT_HANDS))
+                    armorSkill = GetArmorSkill(proto);
+
+                if (proto->Class == ITEM_CLASS_WEAPON && !CanEquipWeapon(cls, proto))
+                    continue;
+
+                if (slot == EQUIPMENT_SLOT_OFFHAND && cls == CLASS_ROGUE && proto->Class != ITEM_CLASS_WEAPON)
+                    continue;
+
+                candidates->push_back({itemId, requiredLevel, armorSkill,
+                                       CalcMixedGearScore(proto->ItemLevel, proto->Quality)});
+            }
+        }
+    }
+
+    return candidates;
+}
+
 bool PlayerbotFactory::IsDesiredReplacement(Item* item)
 {
     if (!item)
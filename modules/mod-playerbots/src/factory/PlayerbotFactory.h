@@ -6,6 +6,10 @@
 #ifndef _PLAYERBOT_PLAYERBOTFACTORY_H
 #define _PLAYERBOT_PLAYERBOTFACTORY_H
 
+#include <memory>
+#include <shared_mutex>
+#include <unordered_map>
+
 #include "InventoryAction.h"
 #include "Player.h"
 #include "PlayerbotAI.h"
@@ -24,6 +28,19 @@ struct EnchantTemplate
 
 typedef std::vector<EnchantTemplate> EnchantContainer;
 
+// Item InitEquipment may pick for a slot, passed every check that does not depend on the bot itself
+struct EquipmentCandidate
+{
+    uint32 itemId;
+    uint32 requiredLevel;
+    // armor skill needed to wear it, 0 for none
+    uint32 armorSkill;
+    uint32 gearScore;
+};
+
+// candidates ordered the way InitEquipment visits them, highest required level first
+typedef std::vector<EquipmentCandidate> EquipmentCandidateList;
+
 // TODO: more spec/role
 /* classid+talenttree
 enum spec : uint8
@@ -160,7 +177,9 @@ private:
 
     std::vector<uint32> GetCurrentGemsCount();
     bool CanEquipArmor(ItemTemplate const* proto);
-    bool CanEquipWeapon(ItemTemplate const* proto);
+    bool CanEquipWeapon(ItemTemplate const* proto) { return CanEquipWeapon(bot->getClass(), proto); }
+    static bool CanEquipWeapon(uint8 cls, ItemTemplate const* proto);
+    static uint32 GetArmorSkill(ItemTemplate const* proto);
     void EnchantItem(Item* item);
     void AddItemStats(uint32 mod, uint8& sp, uint8& ap, uint8& tank);
     bool CheckItemStats(uint8 sp, uint8 ap, uint8 tank);
@@ -176,10 +195,14 @@ private:
     void InitImmersive();
     void AddConsumables();
     static void AddPrevQuests(uint32 questId, std::list<uint32>& questIds);
+    static std::shared_ptr<EquipmentCandidateList const> GetEquipmentCandidates(uint8 cls, uint32 level, uint8 slot,
+                                                                                 uint32 quality);
+    static std::shared_ptr<EquipmentCandidateList const> BuildEquipmentCandidates(uint8 cls, uint32 level, uint8 slot,
+                                                                                   uint32 quality);
     void LoadEnchantContainer();
     void ApplyEnchantTemplate();
     void ApplyEnchantTemplate(uint8 spec);
-    std::vector<InventoryType> GetPossibleInventoryTypeListBySlot(EquipmentSlots slot);
+    static std::vector<InventoryType> GetPossibleInventoryTypeListBySlot(EquipmentSlots slot);
     void IterateItems(IterateItemsVisitor* visitor, IterateItemsMask mask = ITERATE_ITEMS_IN_BAGS);
     void IterateItemsInBags(IterateItemsVisitor* visitor);
     void IterateItemsInEquip(IterateItemsVisitor* visitor);
@@ -193,6 +216,9 @@ private:
     std::vector<uint32> trainerIdCache;
     static std::vector<uint32> enchantSpellIdCache;
     static std::vector<uint32> enchantGemIdCache;
+    // candidates by class, bot level, slot and quality, emptied on config reload
+    static std::unordered_map<uint32, std::shared_ptr<EquipmentCandidateList const>> equipmentCandidates;
+    static std::shared_mutex equipmentCandidatesLock;
 
 protected:
     EnchantContainer m_EnchantContainer;
@@ -6,13 +6,27 @@
 #ifndef _PLAYERBOT_GEARSCORECALCULATOR_H
 #define _PLAYERBOT_GEARSCORECALCULATOR_H
 
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
 #include "Player.h"
 #include "StatsCollector.h"
 
+// STATS_TYPE_MAX padded to whole vector registers
+#define STATS_VECTOR_SIZE 32
+#define STATS_VECTOR_LANES 8
+
 #define ITEM_SUBCLASS_MASK_SINGLE_HAND                                                                        \
     ((1 << ITEM_SUBCLASS_WEAPON_AXE) | (1 << ITEM_SUBCLASS_WEAPON_MACE) | (1 << ITEM_SUBCLASS_WEAPON_SWORD) | \
      (1 << ITEM_SUBCLASS_WEAPON_DAGGER) | (1 << ITEM_SUBCLASS_WEAPON_FIST))
 
+// Collected stats of an item, laid out for a vectorized dot product with the stat weights
+struct alignas(32) StatsVector
+{
+    float values[STATS_VECTOR_SIZE];
+};
+
 enum StatsOverflowThreshold
 {
     SPELL_HIT_OVERFLOW = 14,
@@ -29,13 +43,22 @@ public:
     StatsWeightCalculator(Player* player);
     void Reset();
     float CalculateItem(uint32 itemId);
+    // scores many items against one set of weights, the player must not change in between
+    void CalculateItems(std::vector<uint32> const& itemIds, std::vector<float>& scores);
     float CalculateEnchant(uint32 enchantId);
+    // times scoring every weapon and armor template for the player and logs the result
+    static void Benchmark(Player* player);
 
     void SetOverflowPenalty(bool apply) { enable_overflow_penalty_ = apply; }
     void SetItemSetBonus(bool apply) { enable_item_set_bonus_ = apply; }
     void SetQualityBlend(bool apply) { enable_quality_blend_ = apply; }
 
 private:
+    void PrepareWeights();
+    float ScoreItem(ItemTemplate const* proto);
+    StatsVector const& GetItemStats(ItemTemplate const* proto);
+    static float DotProduct(float const* weights, float const* stats);
+
     void GenerateWeights(Player* player);
     void GenerateBasicWeights(Player* player);
     void GenerateAdditionalWeights(Player* player);
@@ -47,7 +70,7 @@ private:
 
     bool NotBestArmorType(uint32 item_subclass_armor);
 
-    void ApplyOverflowPenalty(Player* player);
+    void GenerateOverflowLimits(Player* player);
     void ApplyWeightFinetune(Player* player);
 
 private:
@@ -62,7 +85,12 @@ private:
     bool enable_quality_blend_;
 
     float weight_;
-    float stats_weights_[STATS_TYPE_MAX];
+    alignas(32) float stats_weights_[STATS_VECTOR_SIZE];
+    float stats_limits_[STATS_VECTOR_SIZE];
+
+    // collected item stats by collector type, class and item, templates never change at runtime
+    static std::unordered_map<uint64, StatsVector> itemStats;
+    static std::shared_mutex itemStatsLock;
 };
 
 #endif
@@ -5,9 +5,33 @@
 
 #include "Action.h"
 
+#include <mutex>
+#include <unordered_map>
+
 #include "Playerbots.h"
 #include "Timer.h"
 
+// action names get ids of their own, the value tables of every bot are sized by the highest value id
+static uint32 InternActionName(std::string const& name)
+{
+    static std::mutex lock;
+    static std::unordered_map<std::string, uint32> ids;
+
+    std::lock_guard<std::mutex> guard(lock);
+    return ids.emplace(name, ids.size()).first->second;
+}
+
+ActionNode::ActionNode(std::string const name, NextAction** prerequisites, NextAction** alternatives,
+                       NextAction** continuers)
+    : name(name),
+      id(InternActionName(name)),
+      action(nullptr),
+      continuers(continuers),
+      alternatives(alternatives),
+      prerequisites(prerequisites)
+{
+}
+
 uint32 NextAction::size(NextAction** actions)
 {
     if (!actions)
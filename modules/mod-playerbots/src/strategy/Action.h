@@ -74,10 +74,7 @@ class ActionNode
 {
 public:
     ActionNode(std::string const name, NextAction** prerequisites = nullptr, NextAction** alternatives = nullptr,
-               NextAction** continuers = nullptr)
-        : name(name), action(nullptr), continuers(continuers), alternatives(alternatives), prerequisites(prerequisites)
-    {
-    }  // reorder arguments - whipowill
+               NextAction** continuers = nullptr);  // reorder arguments - whipowill
 
     virtual ~ActionNode()
     {
@@ -89,19 +86,23 @@ public:
     Action* getAction() { return action; }
     void setAction(Action* action) { this->action = action; }
     std::string const getName() { return name; }
+    // process wide id of the name, the same for the nodes of every bot
+    uint32 getId() const { return id; }
 
-    NextAction** getContinuers() { return NextAction::merge(NextAction::clone(continuers), action->getContinuers()); }
-    NextAction** getAlternatives()
-    {
-        return NextAction::merge(NextAction::clone(alternatives), action->getAlternatives());
-    }
-    NextAction** getPrerequisites()
+    // the node's own arrays unless the action adds to them, then a merged copy the caller owns and deletes
+    NextAction** getContinuers(bool& owned) { return Merge(continuers, action->getContinuers(), owned); }
+    NextAction** getAlternatives(bool& owned) { return Merge(alternatives, action->getAlternatives(), owned); }
+    NextAction** getPrerequisites(bool& owned) { return Merge(prerequisites, action->getPrerequisites(), owned); }
+
+private:
+    static NextAction** Merge(NextAction** own, NextAction** added, bool& owned)
     {
-        return NextAction::merge(NextAction::clone(prerequisites), action->getPrerequisites());
+        owned = added != nullptr;
+        return owned ? NextAction::merge(NextAction::clone(own), added) : own;
     }
 
-private:
     std::string const name;
+    uint32 const id;
     Action* action;
     NextAction** continuers;
     NextAction** alternatives;
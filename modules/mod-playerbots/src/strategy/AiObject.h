@@ -6,6 +6,8 @@
 #ifndef _PLAYERBOT_AIOBJECT_H
 #define _PLAYERBOT_AIOBJECT_H
 
+#include <atomic>
+
 #include "Common.h"
 #include "PlayerbotAIAware.h"
 
@@ -34,6 +36,9 @@ public:
 public:
     virtual std::string const getName() { return name; }
 
+    // performance monitor id of the name, looked up by the first measured scope of this object
+    std::atomic<uint32> performanceId = 0;
+
 protected:
     std::string const name;
 };
@@ -5,6 +5,8 @@
 
 #include "AiObjectContext.h"
 
+#include <mutex>
+
 #include "ActionContext.h"
 #include "ChatActionContext.h"
 #include "ChatTriggerContext.h"
@@ -32,58 +34,67 @@
 #include "dungeons/wotlk/WotlkDungeonActionContext.h"
 #include "dungeons/wotlk/WotlkDungeonTriggerContext.h"
 
+uint32 AiObjectKey::Intern(std::string const& name)
+{
+    static std::mutex lock;
+    static std::unordered_map<std::string, uint32> ids;
+
+    std::lock_guard<std::mutex> guard(lock);
+    return ids.emplace(name, ids.size()).first->second;
+}
+
 AiObjectContext::AiObjectContext(PlayerbotAI* botAI) : PlayerbotAIAware(botAI)
 {
-    strategyContexts.Add(new StrategyContext());
-    strategyContexts.Add(new MovementStrategyContext());
-    strategyContexts.Add(new AssistStrategyContext());
-    strategyContexts.Add(new QuestStrategyContext());
-    strategyContexts.Add(new RaidStrategyContext());
-    strategyContexts.Add(new DungeonStrategyContext());
-
-    actionContexts.Add(new ActionContext());
-    actionContexts.Add(new ChatActionContext());
-    actionContexts.Add(new WorldPacketActionContext());
-    actionContexts.Add(new RaidMcActionContext());
-    actionContexts.Add(new RaidBwlActionContext());
-    actionContexts.Add(new RaidAq20ActionContext());
-    actionContexts.Add(new RaidNaxxActionContext());
-    actionContexts.Add(new RaidUlduarActionContext());
-    actionContexts.Add(new RaidIccActionContext());
-    actionContexts.Add(new WotlkDungeonUKActionContext());
-    actionContexts.Add(new WotlkDungeonNexActionContext());
-    actionContexts.Add(new WotlkDungeonANActionContext());
-    actionContexts.Add(new WotlkDungeonOKActionContext());
-    actionContexts.Add(new WotlkDungeonDTKActionContext());
-    actionContexts.Add(new WotlkDungeonVHActionContext());
-    actionContexts.Add(new WotlkDungeonGDActionContext());
-    actionContexts.Add(new WotlkDungeonHoSActionContext());
-    actionContexts.Add(new WotlkDungeonHoLActionContext());
-    actionContexts.Add(new WotlkDungeonUPActionContext());
-    actionContexts.Add(new WotlkDungeonCoSActionContext());
-
-    triggerContexts.Add(new TriggerContext());
-    triggerContexts.Add(new ChatTriggerContext());
-    triggerContexts.Add(new WorldPacketTriggerContext());
-    triggerContexts.Add(new RaidMcTriggerContext());
-    triggerContexts.Add(new RaidBwlTriggerContext());
-    triggerContexts.Add(new RaidAq20TriggerContext());
-    triggerContexts.Add(new RaidNaxxTriggerContext());
-    triggerContexts.Add(new RaidUlduarTriggerContext());
-    triggerContexts.Add(new RaidIccTriggerContext());
-    triggerContexts.Add(new WotlkDungeonUKTriggerContext());
-    triggerContexts.Add(new WotlkDungeonNexTriggerContext());
-    triggerContexts.Add(new WotlkDungeonANTriggerContext());
-    triggerContexts.Add(new WotlkDungeonOKTriggerContext());
-    triggerContexts.Add(new WotlkDungeonDTKTriggerContext());
-    triggerContexts.Add(new WotlkDungeonVHTriggerContext());
-    triggerContexts.Add(new WotlkDungeonGDTriggerContext());
-    triggerContexts.Add(new WotlkDungeonHoSTriggerContext());
-    triggerContexts.Add(new WotlkDungeonHoLTriggerContext());
-    triggerContexts.Add(new WotlkDungeonUPTriggerContext());
-    triggerContexts.Add(new WotlkDungeonCoSTriggerContext());
-
-    valueContexts.Add(new ValueContext());
+    strategyContexts.Add<StrategyContext>();
+    strategyContexts.Add<MovementStrategyContext>();
+    strategyContexts.Add<AssistStrategyContext>();
+    strategyContexts.Add<QuestStrategyContext>();
+    strategyContexts.Add<RaidStrategyContext>();
+    strategyContexts.Add<DungeonStrategyContext>();
+
+    actionContexts.Add<ActionContext>();
+    actionContexts.Add<ChatActionContext>();
+    actionContexts.Add<WorldPacketActionContext>();
+    actionContexts.Add<RaidMcActionContext>();
+    actionContexts.Add<RaidBwlActionContext>();
+    actionContexts.Add<RaidAq20ActionContext>();
+    actionContexts.Add<RaidNaxxActionContext>();
+    actionContexts.Add<RaidUlduarActionContext>();
+    actionContexts.Add<RaidIccActionContext>();
+    actionContexts.Add<WotlkDungeonUKActionContext>();
+    actionContexts.Add<WotlkDungeonNexActionContext>();
+    actionContexts.Add<WotlkDungeonANActionContext>();
+    actionContexts.Add<WotlkDungeonOKActionContext>();
+    actionContexts.Add<WotlkDungeonDTKActionContext>();
+    actionContexts.Add<WotlkDungeonVHActionContext>();
+    actionContexts.Add<WotlkDungeonGDActionContext>();
+    actionContexts.Add<WotlkDungeonHoSActionContext>();
+    actionContexts.Add<WotlkDungeonHoLActionContext>();
+    actionContexts.Add<WotlkDungeonUPActionContext>();
+    actionContexts.Add<WotlkDungeonCoSActionContext>();
+
+    triggerContexts.Add<TriggerContext>();
+    triggerContexts.Add<ChatTriggerContext>();
+    triggerContexts.Add<WorldPacketTriggerContext>();
+    triggerContexts.Add<RaidMcTriggerContext>();
+    triggerContexts.Add<RaidBwlTriggerContext>();
+    triggerContexts.Add<RaidAq20TriggerContext>();
+    triggerContexts.Add<RaidNaxxTriggerContext>();
+    triggerContexts.Add<RaidUlduarTriggerContext>();
+    triggerContexts.Add<RaidIccTriggerContext>();
+    triggerContexts.Add<WotlkDungeonUKTriggerContext>();
+    triggerContexts.Add<WotlkDungeonNexTriggerContext>();
+    triggerContexts.Add<WotlkDungeonANTriggerContext>();
+    triggerContexts.Add<WotlkDungeonOKTriggerContext>();
+    triggerContexts.Add<WotlkDungeonDTKTriggerContext>();
+    triggerContexts.Add<WotlkDungeonVHTriggerContext>();
+    triggerContexts.Add<WotlkDungeonGDTriggerContext>();
+    triggerContexts.Add<WotlkDungeonHoSTriggerContext>();
+    triggerContexts.Add<WotlkDungeonHoLTriggerContext>();
+    triggerContexts.Add<WotlkDungeonUPTriggerContext>();
+    triggerContexts.Add<WotlkDungeonCoSTriggerContext>();
+
+    valueContexts.Add<ValueContext>();
 
     valueContexts.Add(sSharedValueContext);
 }
@@ -169,8 +180,45 @@ UntypedValue* AiObjectContext::GetUntypedValue(std::string const name)
     return valueContexts.GetContextObject(name, botAI);
 }
 
+UntypedValue* AiObjectContext::GetUntypedValue(AiObjectKey const& key) { return GetValueSlot(key).value; }
+
+UntypedValue* AiObjectContext::GetUntypedValue(AiObjectKey const& key, std::string const& param)
+{
+    return GetValueSlot(key, param).value;
+}
+
+AiObjectContext::ValueSlot& AiObjectContext::GetValueSlot(AiObjectKey const& key)
+{
+    if (key.GetId() >= valueSlots.size())
+        valueSlots.resize(key.GetId() + 1);
+
+    ValueSlot& slot = valueSlots[key.GetId()];
+    if (!slot.value)
+        slot = {GetUntypedValue(key.GetName())};
+
+    return slot;
+}
+
+AiObjectContext::ValueSlot& AiObjectContext::GetValueSlot(AiObjectKey const& key, std::string const& param)
+{
+    if (key.GetId() >= qualifiedValueSlots.size())
+        qualifiedValueSlots.resize(key.GetId() + 1);
+
+    ValueSlot& slot = qualifiedValueSlots[key.GetId()][param];
+    if (!slot.value)
+        slot = {GetUntypedValue(key.GetName() + "::" + param)};
+
+    return slot;
+}
+
 std::set<std::string> AiObjectContext::GetValues() { return valueContexts.GetCreated(); }
 
+size_t AiObjectContext::GetCreatorCount() const
+{
+    return strategyContexts.GetCreatorCount() + actionContexts.GetCreatorCount() +
+           triggerContexts.GetCreatorCount() + valueContexts.GetCreatorCount();
+}
+
 std::set<std::string> AiObjectContext::GetSupportedStrategies() { return strategyContexts.supports(); }
 
 std::set<std::string> AiObjectContext::GetSupportedActions() { return actionContexts.supports(); }
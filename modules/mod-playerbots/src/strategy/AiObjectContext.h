@@ -8,6 +8,8 @@
 
 #include <sstream>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "Common.h"
 #include "DynamicObject.h"
@@ -19,6 +21,22 @@
 
 class PlayerbotAI;
 
+// Value name interned to a process wide id, a bot keeps the value it resolves to in a slot of that id
+class AiObjectKey
+{
+public:
+    explicit AiObjectKey(std::string const name) : name(name), id(Intern(name)) {}
+
+    std::string const& GetName() const { return name; }
+    uint32 GetId() const { return id; }
+
+private:
+    static uint32 Intern(std::string const& name);
+
+    std::string name;
+    uint32 id;
+};
+
 class AiObjectContext : public PlayerbotAIAware
 {
 public:
@@ -51,25 +69,87 @@ public:
         return GetValue<T>(name, out.str());
     }
 
+    template <class T>
+    Value<T>* GetValue(AiObjectKey const& key)
+    {
+        return GetTypedValue<T>(GetValueSlot(key));
+    }
+
+    template <class T>
+    Value<T>* GetValue(AiObjectKey const& key, std::string const param)
+    {
+        return GetTypedValue<T>(GetValueSlot(key, param));
+    }
+
+    template <class T>
+    Value<T>* GetValue(AiObjectKey const& key, int32 param)
+    {
+        return GetValue<T>(key, std::to_string(param));
+    }
+
+    UntypedValue* GetUntypedValue(AiObjectKey const& key);
+    UntypedValue* GetUntypedValue(AiObjectKey const& key, std::string const& param);
+
     std::set<std::string> GetValues();
     std::set<std::string> GetSupportedStrategies();
     std::set<std::string> GetSupportedActions();
     std::string const FormatValues();
+    // entries of the creator tables this context looks names up in, shared by the contexts of all bots
+    size_t GetCreatorCount() const;
 
     virtual void Update();
     virtual void Reset();
     virtual void AddShared(NamedObjectContext<UntypedValue>* sharedValues);
 
+    void OnExternalEvent() { ++externalEvents; }
+    uint32 GetExternalEvents() const { return externalEvents; }
+
     std::vector<std::string> Save();
     void Load(std::vector<std::string> data);
 
-    std::vector<std::string> performanceStack;
+    PerformanceStack performanceStack;
 
 protected:
     NamedObjectContextList<Strategy> strategyContexts;
     NamedObjectContextList<Action> actionContexts;
     NamedObjectContextList<Trigger> triggerContexts;
     NamedObjectContextList<UntypedValue> valueContexts;
+
+private:
+    // A resolved value with the Value<T> it was last cast to, only a different T casts again
+    struct ValueSlot
+    {
+        UntypedValue* value = nullptr;
+        void* typed = nullptr;
+        void const* type = nullptr;
+    };
+
+    template <class T>
+    static void const* TypeTag()
+    {
+        static char const tag = 0;
+        return &tag;
+    }
+
+    template <class T>
+    static Value<T>* GetTypedValue(ValueSlot& slot)
+    {
+        if (slot.type != TypeTag<T>())
+        {
+            slot.typed = dynamic_cast<Value<T>*>(slot.value);
+            slot.type = TypeTag<T>();
+        }
+
+        return static_cast<Value<T>*>(slot.typed);
+    }
+
+    ValueSlot& GetValueSlot(AiObjectKey const& key);
+    ValueSlot& GetValueSlot(AiObjectKey const& key, std::string const& param);
+
+    uint32 externalEvents = 0;
+    // values are owned by the value contexts and live as long as this context
+    std::vector<ValueSlot> valueSlots;
+    std::vector<std::unordered_map<std::string, ValueSlot>> qualifiedValueSlots;
 };
 
 #endif
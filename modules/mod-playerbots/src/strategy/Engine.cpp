@@ -16,6 +16,14 @@ Engine::Engine(PlayerbotAI* botAI, AiObjectContext* factory) : PlayerbotAIAware(
 {
     lastRelevance = 0.0f;
     testMode = false;
+    triggersPrepared = false;
+    preparedMinimal = false;
+    checkEventTriggers = true;
+    eventTriggersChecked = false;
+    lastExternalEvents = 0;
+    triggerTime = 0;
+    lastTriggerMSTime = getMSTime();
+    pendingExternalEvents = 0;
 }
 
 bool ActionExecutionListeners::Before(Action* action, Event event)
@@ -72,6 +80,7 @@ ActionExecutionListeners::~ActionExecutionListeners()
 Engine::~Engine(void)
 {
     Reset();
+    DeleteRetiredActionNodes();
 
     // for (std::map<std::string, Strategy*>::iterator i = strategies.begin(); i != strategies.end(); i++)
     // {
@@ -87,15 +96,16 @@ Engine::~Engine(void)
 void Engine::Reset()
 {
     strategyTypeMask = 0;
-    ActionNode* action = nullptr;
-    do
+    while (queue.Pop())
     {
-        action = queue.Pop();
-        if (!action)
-            break;
+    }
+
+    // the next strategy set may resolve names differently. An action changing strategies runs while its own node
+    // is still in use, so the nodes are only deleted when the next tick starts.
+    for (std::unordered_map<std::string, ActionNode*>::iterator i = actionNodes.begin(); i != actionNodes.end(); i++)
+        retiredActionNodes.push_back(i->second);
 
-        delete action;
-    } while (true);
+    actionNodes.clear();
 
     for (std::vector<TriggerNode*>::iterator i = triggers.begin(); i != triggers.end(); i++)
     {
@@ -104,6 +114,11 @@ void Engine::Reset()
     }
 
     triggers.clear();
+    ClearTriggerPass();
+    scheduledTriggers.clear();
+    polledTriggers.clear();
+    eventTriggers.clear();
+    timedTriggers = decltype(timedTriggers)();
 
     for (std::vector<Multiplier*>::iterator i = multipliers.begin(); i != multipliers.end(); i++)
     {
@@ -129,6 +144,8 @@ void Engine::Init()
         MultiplyAndPush(strategy->getDefaultActions(), 0.0f, false, emptyEvent, "default");
     }
 
+    ScheduleTriggers();
+
     if (testMode)
     {
         FILE* file = fopen("test.log", "w");
@@ -139,6 +156,8 @@ void Engine::Init()
 
 bool Engine::DoNextAction(Unit* unit, uint32 depth, bool minimal)
 {
+    DeleteRetiredActionNodes();
+
     LogAction("--- AI Tick ---");
 
     if (sPlayerbotAIConfig->logValuesPerTick)
@@ -202,31 +221,35 @@ bool Engine::DoNextAction(Unit* unit, uint32 depth, bool minimal)
                     {
                         LogAction("A:%s - PREREQ", action->getName().c_str());
 
-                        if (MultiplyAndPush(actionNode->getPrerequisites(), relevance + 0.002f, false, event, "prereq"))
+                        bool owned = false;
+                        NextAction** prerequisites = actionNode->getPrerequisites(owned);
+                        if (MultiplyAndPush(prerequisites, relevance + 0.002f, false, event, "prereq", owned))
                         {
                             PushAgain(actionNode, relevance + 0.001f, event);
                             continue;
                         }
                     }
 
-                    PerformanceMonitorOperation* pmo = sPerformanceMonitor->start(PERF_MON_ACTION, action->getName(),
-                                                                                  &aiObjectContext->performanceStack);
-                    actionExecuted = ListenAndExecute(action, event);
-                    if (pmo)
-                        pmo->finish();
+                    {
+                        PerformanceMonitorScope pms(PERF_MON_ACTION, action, &aiObjectContext->performanceStack);
+                        actionExecuted = ListenAndExecute(action, event);
+                    }
 
                     if (actionExecuted)
                     {
                         LogAction("A:%s - OK", action->getName().c_str());
-                        MultiplyAndPush(actionNode->getContinuers(), relevance, false, event, "cont");
+                        bool owned = false;
+                        NextAction** continuers = actionNode->getContinuers(owned);
+                        MultiplyAndPush(continuers, relevance, false, event, "cont", owned);
                         lastRelevance = relevance;
-                        delete actionNode;
                         break;
                     }
                     else
                     {
                         LogAction("A:%s - FAILED", action->getName().c_str());
-                        MultiplyAndPush(actionNode->getAlternatives(), relevance + 0.003f, false, event, "alt");
+                        bool owned = false;
+                        NextAction** alternatives = actionNode->getAlternatives(owned);
+                        MultiplyAndPush(alternatives, relevance + 0.003f, false, event, "alt", owned);
                     }
                 }
                 else
@@ -246,7 +269,9 @@ bool Engine::DoNextAction(Unit* unit, uint32 depth, bool minimal)
                         botAI->TellMasterNoFacing(out);
                     }
                     LogAction("A:%s - IMPOSSIBLE", action->getName().c_str());
-                    MultiplyAndPush(actionNode->getAlternatives(), relevance + 0.003f, false, event, "alt");
+                    bool owned = false;
+                    NextAction** alternatives = actionNode->getAlternatives(owned);
+                    MultiplyAndPush(alternatives, relevance + 0.003f, false, event, "alt", owned);
                 }
             }
             else
@@ -268,8 +293,6 @@ bool Engine::DoNextAction(Unit* unit, uint32 depth, bool minimal)
                 lastRelevance = relevance;
                 LogAction("A:%s - USELESS", action->getName().c_str());
             }
-
-            delete actionNode;
         }
     } while (basket && ++iterations <= iterationsPerTick);
 
@@ -310,6 +333,25 @@ bool Engine::DoNextAction(Unit* unit, uint32 depth, bool minimal)
     return actionExecuted;
 }
 
+void Engine::DeleteRetiredActionNodes()
+{
+    for (ActionNode* node : retiredActionNodes)
+        delete node;
+
+    retiredActionNodes.clear();
+}
+
+ActionNode* Engine::GetActionNode(std::string const name)
+{
+    std::unordered_map<std::string, ActionNode*>::iterator itr = actionNodes.find(name);
+    if (itr != actionNodes.end())
+        return itr->second;
+
+    ActionNode* node = CreateActionNode(name);
+    actionNodes[name] = node;
+    return node;
+}
+
 ActionNode* Engine::CreateActionNode(std::string const name)
 {
     for (std::map<std::string, Strategy*>::iterator i = strategies.begin(); i != strategies.end(); i++)
@@ -325,7 +367,7 @@ ActionNode* Engine::CreateActionNode(std::string const name)
 }
 
 bool Engine::MultiplyAndPush(NextAction** actions, float forceRelevance, bool skipPrerequisites, Event event,
-                             char const* pushType)
+                             char const* pushType, bool owned)
 {
     bool pushed = false;
     if (actions)
@@ -334,7 +376,7 @@ bool Engine::MultiplyAndPush(NextAction** actions, float forceRelevance, bool sk
         {
             if (NextAction* nextAction = actions[j])
             {
-                ActionNode* action = CreateActionNode(nextAction->getName());
+                ActionNode* action = GetActionNode(nextAction->getName());
                 InitializeAction(action);
 
                 float k = nextAction->getRelevance();
@@ -346,21 +388,19 @@ bool Engine::MultiplyAndPush(NextAction** actions, float forceRelevance, bool sk
                 if (k > 0)
                 {
                     LogAction("PUSH:%s - %f (%s)", action->getName().c_str(), k, pushType);
-                    queue.Push(new ActionBasket(action, k, skipPrerequisites, event));
+                    queue.Push(action, k, skipPrerequisites, event);
                     pushed = true;
                 }
-                else
-                {
-                    delete action;
-                }
 
-                delete nextAction;
+                if (owned)
+                    delete nextAction;
             }
             else
                 break;
         }
 
-        delete[] actions;
+        if (owned)
+            delete[] actions;
     }
 
     return pushed;
@@ -370,16 +410,13 @@ ActionResult Engine::ExecuteAction(std::string const name, Event event, std::str
 {
     bool result = false;
 
-    ActionNode* actionNode = CreateActionNode(name);
+    ActionNode* actionNode = GetActionNode(name);
     if (!actionNode)
         return ACTION_RESULT_UNKNOWN;
 
     Action* action = InitializeAction(actionNode);
     if (!action)
-    {
-        delete actionNode;
         return ACTION_RESULT_UNKNOWN;
-    }
 
     if (!qualifier.empty())
     {
@@ -388,24 +425,16 @@ ActionResult Engine::ExecuteAction(std::string const name, Event event, std::str
     }
 
     if (!action->isPossible())
-    {
-        delete actionNode;
         return ACTION_RESULT_IMPOSSIBLE;
-    }
 
     if (!action->isUseful())
-    {
-        delete actionNode;
         return ACTION_RESULT_USELESS;
-    }
 
     action->MakeVerbose();
 
     result = ListenAndExecute(action, event);
     MultiplyAndPush(action->getContinuers(), 0.0f, false, event, "default");
 
-    delete actionNode;
-
     return result ? ACTION_RESULT_OK : ACTION_RESULT_FAILED;
 }
 
@@ -493,12 +522,87 @@ void Engine::toggleStrategy(std::string const name)
 
 bool Engine::HasStrategy(std::string const name) { return strategies.find(name) != strategies.end(); }
 
+void Engine::PrepareTriggers(bool minimal)
+{
+    ClearPreparedTriggers();
+
+    // only triggers declaring themselves parallel safe run off the map thread, timed ones keep their check time there
+    for (uint32 index : polledTriggers)
+    {
+        if (!scheduledTriggers[index].parallelSafe)
+            continue;
+
+        CheckTrigger(index, minimal);
+        scheduledTriggers[index].prepared = true;
+    }
+
+    triggersPrepared = true;
+    preparedMinimal = minimal;
+}
+
+void Engine::ClearPreparedTriggers() { ClearTriggerPass(); }
+
+void Engine::ClearTriggerPass()
+{
+    for (uint32 index : checkedTriggers)
+        scheduledTriggers[index].prepared = false;
+
+    fires.clear();
+    checkedTriggers.clear();
+    eventTriggersChecked = false;
+    triggersPrepared = false;
+}
+
 void Engine::ProcessTriggers(bool minimal)
 {
-    std::unordered_map<Trigger*, Event> fires;
-    for (std::vector<TriggerNode*>::iterator i = triggers.begin(); i != triggers.end(); i++)
+    // the parallel bot update checked some triggers ahead of time, a minimal pass skipped the low relevance ones
+    if (triggersPrepared && preparedMinimal && !minimal)
+        ClearTriggerPass();
+
+    CheckTriggers(minimal);
+
+    // handlers are pushed in strategy order, the same trigger may be handled by several strategies
+    firedNodes.clear();
+    for (uint32 index : checkedTriggers)
+    {
+        ScheduledTrigger const& scheduled = scheduledTriggers[index];
+        if (fires.find(scheduled.trigger) != fires.end())
+        {
+            LogAction("T:%s", scheduled.trigger->getName().c_str());
+            firedNodes.insert(firedNodes.end(), scheduled.nodes.begin(), scheduled.nodes.end());
+        }
+    }
+
+    std::sort(firedNodes.begin(), firedNodes.end());
+    firedNodes.erase(std::unique(firedNodes.begin(), firedNodes.end()), firedNodes.end());
+
+    for (uint32 nodeIndex : firedNodes)
+    {
+        TriggerNode* node = triggers[nodeIndex];
+        Event event = fires[node->getTrigger()];
+        bool owned = false;
+        NextAction** handlers = node->getHandlers(owned);
+        MultiplyAndPush(handlers, 0.0f, false, event, "trigger", owned);
+    }
+
+    for (uint32 index : checkedTriggers)
+        scheduledTriggers[index].trigger->Reset();
+
+    if (eventTriggersChecked)
+    {
+        lastExternalEvents = pendingExternalEvents;
+        checkEventTriggers = false;
+    }
+
+    ClearTriggerPass();
+}
+
+void Engine::ScheduleTriggers()
+{
+    std::unordered_map<Trigger*, uint32> indices;
+    for (uint32 i = 0; i < triggers.size(); ++i)
     {
-        TriggerNode* node = *i;
+        TriggerNode* node = triggers[i];
         if (!node)
             continue;
 
@@ -512,44 +616,109 @@ void Engine::ProcessTriggers(bool minimal)
         if (!trigger)
             continue;
 
-        if (fires.find(trigger) != fires.end())
-            continue;
-
-        if (testMode || trigger->needCheck())
+        std::pair<std::unordered_map<Trigger*, uint32>::iterator, bool> itr =
+            indices.emplace(trigger, scheduledTriggers.size());
+        if (itr.second)
         {
-            if (minimal && node->getFirstRelevance() < 100)
-                continue;
+            uint32 index = scheduledTriggers.size();
+            bool timed = !trigger->IsEventDriven() && trigger->getCheckInterval() >= 2;
+            scheduledTriggers.push_back({trigger, {}, -1.0f, timed, 0, trigger->IsParallelSafe(), false});
+
+            if (trigger->IsEventDriven())
+                eventTriggers.push_back(index);
+            else if (timed)
+                timedTriggers.push(std::make_pair(0, index));
+            else
+                polledTriggers.push_back(index);
+        }
 
-            PerformanceMonitorOperation* pmo =
-                sPerformanceMonitor->start(PERF_MON_TRIGGER, trigger->getName(), &aiObjectContext->performanceStack);
-            Event event = trigger->Check();
-            if (pmo)
-                pmo->finish();
+        ScheduledTrigger& scheduled = scheduledTriggers[itr.first->second];
+        scheduled.nodes.push_back(i);
+        scheduled.relevance = std::max(scheduled.relevance, node->getFirstRelevance());
+    }
 
-            if (!event)
-                continue;
+    checkEventTriggers = true;
+}
 
-            fires[trigger] = event;
-            LogAction("T:%s", trigger->getName().c_str());
-        }
+void Engine::CheckTriggers(bool minimal)
+{
+    if (testMode)
+    {
+        for (uint32 index = 0; index < scheduledTriggers.size(); ++index)
+            CheckTrigger(index, minimal);
+
+        pendingExternalEvents = aiObjectContext->GetExternalEvents();
+        eventTriggersChecked = true;
+        return;
     }
 
-    for (std::vector<TriggerNode*>::iterator i = triggers.begin(); i != triggers.end(); i++)
+    for (uint32 index : polledTriggers)
+        CheckTrigger(index, minimal);
+
+    // due times count getMSTime milliseconds like the trigger check times, widened so they survive its wrap
+    uint32 msTime = getMSTime();
+    triggerTime += getMSTimeDiff(lastTriggerMSTime, msTime);
+    lastTriggerMSTime = msTime;
+
+    uint64 now = triggerTime;
+    while (!timedTriggers.empty() && timedTriggers.top().first <= now)
     {
-        TriggerNode* node = *i;
-        Trigger* trigger = node->getTrigger();
-        if (fires.find(trigger) == fires.end())
+        std::pair<uint64, uint32> entry = timedTriggers.top();
+        timedTriggers.pop();
+
+        ScheduledTrigger& scheduled = scheduledTriggers[entry.second];
+        if (entry.first != scheduled.due)
             continue;
 
-        Event event = fires[trigger];
-        MultiplyAndPush(node->getHandlers(), 0.0f, false, event, "trigger");
+        Trigger* trigger = scheduled.trigger;
+        bool check = trigger->needCheck();
+
+        // the trigger object is shared with the other engines of the bot, which may have checked it recently
+        uint32 delay = trigger->getCheckInterval();
+        if (!check)
+            delay -= std::min(delay - 1, getMSTimeDiff(trigger->getLastCheckTime(), msTime));
+
+        scheduled.due = now + delay;
+        timedTriggers.push(std::make_pair(scheduled.due, entry.second));
+
+        if (check)
+            CheckTrigger(entry.second, minimal);
     }
 
-    for (std::vector<TriggerNode*>::iterator i = triggers.begin(); i != triggers.end(); i++)
+    // chat command and packet triggers can only become active through an external event
+    uint32 externalEvents = aiObjectContext->GetExternalEvents();
+    if (checkEventTriggers || externalEvents != lastExternalEvents)
+    {
+        for (uint32 index : eventTriggers)
+            CheckTrigger(index, minimal);
+
+        pendingExternalEvents = externalEvents;
+        eventTriggersChecked = true;
+    }
+}
+
+void Engine::CheckTrigger(uint32 index, bool minimal)
+{
+    ScheduledTrigger const& scheduled = scheduledTriggers[index];
+    Trigger* trigger = scheduled.trigger;
+    if (scheduled.prepared || fires.find(trigger) != fires.end())
+        return;
+
+    checkedTriggers.push_back(index);
+
+    if (minimal && scheduled.relevance < 100)
+        return;
+
+    Event event;
     {
-        if (Trigger* trigger = (*i)->getTrigger())
-            trigger->Reset();
+        PerformanceMonitorScope pms(PERF_MON_TRIGGER, trigger, &aiObjectContext->performanceStack);
+        event = trigger->Check();
     }
+
+    if (!event)
+        return;
+
+    fires[trigger] = event;
 }
 
 void Engine::PushDefaultActions()
@@ -595,7 +764,6 @@ void Engine::PushAgain(ActionNode* actionNode, float relevance, Event event)
     nextAction[0] = new NextAction(actionNode->getName(), relevance);
     nextAction[1] = nullptr;
     MultiplyAndPush(nextAction, relevance, true, event, "again");
-    delete actionNode;
 }
 
 bool Engine::ContainsStrategy(StrategyType type)
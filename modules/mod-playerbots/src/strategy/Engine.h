@@ -7,6 +7,7 @@
 #define _PLAYERBOT_ENGINE_H
 
 #include <map>
+#include <queue>
 
 #include "Multiplier.h"
 #include "PlayerbotAIAware.h"
@@ -59,6 +60,19 @@ private:
     std::list<ActionExecutionListener*> listeners;
 };
 
+// Trigger nodes grouped by their trigger, a trigger used by several strategies is checked once per pass
+struct ScheduledTrigger
+{
+    Trigger* trigger;
+    std::vector<uint32> nodes;
+    float relevance;
+    bool timed;
+    uint64 due;
+    // may be checked by the parallel bot update, and was checked by it in the current pass
+    bool parallelSafe;
+    bool prepared;
+};
+
 class Engine : public PlayerbotAIAware
 {
 public:
@@ -77,8 +91,11 @@ public:
     bool ContainsStrategy(StrategyType type);
     void ChangeStrategy(std::string const names);
     std::string const GetLastAction() { return lastAction; }
+    Queue& GetQueue() { return queue; }
 
     virtual bool DoNextAction(Unit*, uint32 depth = 0, bool minimal = false);
+    void PrepareTriggers(bool minimal);
+    void ClearPreparedTriggers();
     ActionResult ExecuteAction(std::string const name, Event event = Event(), std::string const qualifier = "");
 
     void AddActionExecutionListener(ActionExecutionListener* listener) { actionExecutionListeners.Add(listener); }
@@ -90,12 +107,19 @@ public:
     bool testMode;
 
 private:
+    // owned arrays are deleted after the push, cached ones belong to their node
     bool MultiplyAndPush(NextAction** actions, float forceRelevance, bool skipPrerequisites, Event event,
-                         const char* pushType);
+                         const char* pushType, bool owned = true);
     void Reset();
     void ProcessTriggers(bool minimal);
+    void ScheduleTriggers();
+    void CheckTriggers(bool minimal);
+    void CheckTrigger(uint32 index, bool minimal);
+    void ClearTriggerPass();
     void PushDefaultActions();
     void PushAgain(ActionNode* actionNode, float relevance, Event event);
+    void DeleteRetiredActionNodes();
+    ActionNode* GetActionNode(std::string const name);
     ActionNode* CreateActionNode(std::string const name);
     Action* InitializeAction(ActionNode* actionNode);
     bool ListenAndExecute(Action* action, Event event);
@@ -108,9 +132,31 @@ private:
 protected:
     Queue queue;
     std::vector<TriggerNode*> triggers;
+    std::unordered_map<Trigger*, Event> fires;
+    bool triggersPrepared;
+    bool preparedMinimal;
+    // triggers are checked every tick, when their interval elapsed, or after an external event reached the bot
+    std::vector<ScheduledTrigger> scheduledTriggers;
+    std::vector<uint32> polledTriggers;
+    std::vector<uint32> eventTriggers;
+    std::priority_queue<std::pair<uint64, uint32>, std::vector<std::pair<uint64, uint32>>,
+                        std::greater<std::pair<uint64, uint32>>>
+        timedTriggers;
+    uint64 triggerTime;
+    uint32 lastTriggerMSTime;
+    std::vector<uint32> checkedTriggers;
+    std::vector<uint32> firedNodes;
+    bool checkEventTriggers;
+    bool eventTriggersChecked;
+    uint32 lastExternalEvents;
+    uint32 pendingExternalEvents;
     std::vector<Multiplier*> multipliers;
     AiObjectContext* aiObjectContext;
     std::map<std::string, Strategy*> strategies;
+    // nodes of the current strategy set by action name, shared by all baskets that queue the action
+    std::unordered_map<std::string, ActionNode*> actionNodes;
+    // nodes of a previous strategy set, kept until the tick that dropped them is over
+    std::vector<ActionNode*> retiredActionNodes;
     float lastRelevance;
     std::string lastAction;
     uint32 strategyTypeMask;
@@ -12,16 +12,22 @@ Event::Event(std::string const source, ObjectGuid object, Player* owner) : sourc
     packet << object;
 }
 
-ObjectGuid Event::getObject()
+WorldPacket& Event::getPacket()
 {
-    if (packet.empty())
-        return ObjectGuid::Empty;
+    if (sharedPacket)
+    {
+        packet = *sharedPacket;
+        sharedPacket.reset();
+    }
 
-    WorldPacket p(packet);
-    p.rpos(0);
+    return packet;
+}
 
-    ObjectGuid guid;
-    p >> guid;
+ObjectGuid Event::getObject()
+{
+    WorldPacket const& p = getPacket();
+    if (p.empty())
+        return ObjectGuid::Empty;
 
-    return guid;
+    return ObjectGuid(p.read<uint64>(0));
 }
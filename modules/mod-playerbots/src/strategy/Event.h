@@ -6,6 +6,8 @@
 #ifndef _PLAYERBOT_EVENT_H
 #define _PLAYERBOT_EVENT_H
 
+#include <memory>
+
 #include "WorldPacket.h"
 
 class ObjectGuid;
@@ -14,7 +16,14 @@ class Player;
 class Event
 {
 public:
-    Event(Event const& other) : source(other.source), param(other.param), packet(other.packet), owner(other.owner) {}
+    Event(Event const& other)
+        : source(other.source),
+          param(other.param),
+          packet(other.packet),
+          sharedPacket(other.sharedPacket),
+          owner(other.owner)
+    {
+    }
     Event() {}
     Event(std::string const source) : source(source) {}
     Event(std::string const source, std::string const param, Player* owner = nullptr)
@@ -25,12 +34,17 @@ public:
         : source(source), packet(packet), owner(owner)
     {
     }
+    // the packet is only copied when an action reads it, until then all copies of the event share it
+    Event(std::string const source, std::shared_ptr<WorldPacket const> packet, Player* owner = nullptr)
+        : source(source), sharedPacket(std::move(packet)), owner(owner)
+    {
+    }
     Event(std::string const source, ObjectGuid object, Player* owner = nullptr);
     virtual ~Event() {}
 
     std::string const GetSource() { return source; }
     std::string const getParam() { return param; }
-    WorldPacket& getPacket() { return packet; }
+    WorldPacket& getPacket();
     ObjectGuid getObject();
     Player* getOwner() { return owner; }
     bool operator!() const { return source.empty(); }
@@ -39,6 +53,7 @@ protected:
     std::string source;
     std::string param;
     WorldPacket packet;
+    std::shared_ptr<WorldPacket const> sharedPacket;
     Player* owner = nullptr;
 };
 
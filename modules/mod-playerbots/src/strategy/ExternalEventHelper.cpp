@@ -39,10 +39,10 @@ bool ExternalEventHelper::ParseChatCommand(std::string const command, Player* ow
     return true;
 }
 
-void ExternalEventHelper::HandlePacket(std::map<uint16, std::string>& handlers, WorldPacket const& packet,
-                                       Player* owner)
+void ExternalEventHelper::HandlePacket(std::map<uint16, std::string>& handlers,
+                                       std::shared_ptr<WorldPacket const> const& packet, Player* owner)
 {
-    uint16 opcode = packet.GetOpcode();
+    uint16 opcode = packet->GetOpcode();
     std::string const name = handlers[opcode];
     if (name.empty())
         return;
@@ -51,8 +51,8 @@ void ExternalEventHelper::HandlePacket(std::map<uint16, std::string>& handlers,
     if (!trigger)
         return;
 
-    WorldPacket p(packet);
-    trigger->ExternalEvent(p, owner);
+    trigger->ExternalEvent(packet, owner);
+    aiObjectContext->OnExternalEvent();
 }
 
 bool ExternalEventHelper::HandleCommand(std::string const name, std::string const param, Player* owner)
@@ -62,6 +62,7 @@ bool ExternalEventHelper::HandleCommand(std::string const name, std::string cons
         return false;
 
     trigger->ExternalEvent(param, owner);
+    aiObjectContext->OnExternalEvent();
 
     return true;
 }
@@ -7,6 +7,7 @@
 #define _PLAYERBOT_NAMEDOBJECTCONEXT_H
 
 #include <list>
+#include <mutex>
 #include <set>
 #include <unordered_map>
 #include <unordered_set>
@@ -42,9 +43,20 @@ class NamedObjectFactory
 {
 protected:
     typedef T* (*ActionCreator)(PlayerbotAI* botAI);
-    std::unordered_map<std::string, ActionCreator> creators;
+    typedef std::unordered_map<std::string, ActionCreator> CreatorMap;
+
+    // filled by the constructor of the concrete factory
+    CreatorMap creators;
+    // set when the creators of a shared prototype are used instead of an own table
+    CreatorMap const* registry;
+
+    CreatorMap const& GetCreators() const { return registry ? *registry : creators; }
 
 public:
+    NamedObjectFactory() : registry(nullptr) {}
+    explicit NamedObjectFactory(NamedObjectFactory<T> const* prototype) : registry(&prototype->GetCreators()) {}
+    virtual ~NamedObjectFactory() {}
+
     T* create(std::string name, PlayerbotAI* botAI)
     {
         size_t found = name.find("::");
@@ -55,10 +67,12 @@ public:
             name = name.substr(0, found);
         }
 
-        if (creators.find(name) == creators.end())
+        CreatorMap const& table = GetCreators();
+        typename CreatorMap::const_iterator itr = table.find(name);
+        if (itr == table.end())
             return nullptr;
 
-        ActionCreator creator = creators[name];
+        ActionCreator creator = itr->second;
         if (!creator)
             return nullptr;
 
@@ -73,12 +87,14 @@ public:
     std::set<std::string> supports()
     {
         std::set<std::string> keys;
-        for (typename std::unordered_map<std::string, ActionCreator>::iterator it = creators.begin();
-             it != creators.end(); it++)
+        CreatorMap const& table = GetCreators();
+        for (typename CreatorMap::const_iterator it = table.begin(); it != table.end(); it++)
             keys.insert(it->first);
 
         return keys;
     }
+
+    size_t GetCreatorCount() const { return GetCreators().size(); }
 };
 
 template <class T>
@@ -90,10 +106,21 @@ public:
     {
     }
 
+    // per bot context with its own created objects, creating them through the table of the prototype
+    explicit NamedObjectContext(NamedObjectContext<T> const* prototype)
+        : NamedObjectFactory<T>(prototype), shared(prototype->shared), supportsSiblings(prototype->supportsSiblings)
+    {
+    }
+
     virtual ~NamedObjectContext() { Clear(); }
 
     T* create(std::string const name, PlayerbotAI* botAI)
     {
+        // shared contexts are reached by every bot, also from the threads of the parallel bot update
+        std::unique_lock<std::mutex> guard;
+        if (shared)
+            guard = std::unique_lock<std::mutex>(SharedCreateLock());
+
         if (created.find(name) == created.end())
             return created[name] = NamedObjectFactory<T>::create(name, botAI);
 
@@ -142,6 +169,12 @@ public:
     }
 
 protected:
+    static std::mutex& SharedCreateLock()
+    {
+        static std::mutex lock;
+        return lock;
+    }
+
     std::unordered_map<std::string, T*> created;
     bool shared;
     bool supportsSiblings;
@@ -163,6 +196,14 @@ public:
 
     void Add(NamedObjectContext<T>* context) { contexts.push_back(context); }
 
+    // the creator table of a context type is built once, every bot only owns the objects it created
+    template <class C>
+    void Add()
+    {
+        static C prototype;
+        contexts.push_back(new NamedObjectContext<T>(&prototype));
+    }
+
     T* GetContextObject(std::string const name, PlayerbotAI* botAI)
     {
         for (typename std::vector<NamedObjectContext<T>*>::iterator i = contexts.begin(); i != contexts.end(); i++)
@@ -238,6 +279,15 @@ public:
         return result;
     }
 
+    size_t GetCreatorCount() const
+    {
+        size_t count = 0;
+        for (NamedObjectContext<T> const* context : contexts)
+            count += context->GetCreatorCount();
+
+        return count;
+    }
+
 private:
     std::vector<NamedObjectContext<T>*> contexts;
 };
@@ -254,6 +304,13 @@ public:
 
     void Add(NamedObjectFactory<T>* context) { factories.push_front(context); }
 
+    template <class C>
+    void Add()
+    {
+        static C prototype;
+        factories.push_front(new NamedObjectFactory<T>(&prototype));
+    }
+
     T* GetContextObject(std::string const& name, PlayerbotAI* botAI)
     {
         for (typename std::list<NamedObjectFactory<T>*>::iterator i = factories.begin(); i != factories.end(); i++)
@@ -5,100 +5,323 @@
 
 #include "Queue.h"
 
+#include <atomic>
+#include <chrono>
+#include <list>
+#include <mutex>
+
 #include "AiObjectContext.h"
 #include "Log.h"
 #include "PlayerbotAIConfig.h"
 
-void Queue::Push(ActionBasket* action)
+// only one queue is recorded at a time, the pointer is compared and never dereferenced
+static std::atomic<Queue const*> recordedQueue = nullptr;
+static std::mutex recordLock;
+static std::vector<QueueOperation> recordedOperations;
+static uint32 recordLimit = 0;
+
+Queue::~Queue(void)
 {
-    if (action)
+    // a queue allocated at the same address later must not continue the recording, the next command starts over
+    Queue const* self = this;
+    if (recordedQueue.compare_exchange_strong(self, nullptr))
     {
-        for (std::list<ActionBasket*>::iterator iter = actions.begin(); iter != actions.end(); iter++)
-        {
-            ActionBasket* basket = *iter;
-            if (action->getAction()->getName() == basket->getAction()->getName())
-            {
-                if (basket->getRelevance() < action->getRelevance())
-                    basket->setRelevance(action->getRelevance());
+        std::lock_guard<std::mutex> guard(recordLock);
+        recordedOperations.clear();
+        recordLimit = 0;
+    }
+
+    for (Entry const& entry : heap)
+        delete entry.basket;
 
-                if (ActionNode* actionNode = action->getAction())
-                    delete actionNode;
+    for (ActionBasket* basket : freeBaskets)
+        delete basket;
+}
+
+void Queue::Push(ActionNode* action, float relevance, bool skipPrerequisites, Event event)
+{
+    if (!action)
+        return;
 
-                delete action;
+    if (recordedQueue.load(std::memory_order_relaxed) == this)
+        RecordOperation(action->getName(), relevance);
 
-                return;
-            }
+    std::unordered_map<uint32, uint32>::iterator itr = positions.find(action->getId());
+    if (itr != positions.end())
+    {
+        ActionBasket* basket = heap[itr->second].basket;
+        if (basket->getRelevance() < relevance)
+        {
+            basket->setRelevance(relevance);
+            SiftUp(itr->second);
         }
 
-        actions.push_back(action);
+        return;
+    }
+
+    ActionBasket* basket = nullptr;
+    if (freeBaskets.empty())
+        basket = new ActionBasket(action, relevance, skipPrerequisites, event);
+    else
+    {
+        basket = freeBaskets.back();
+        freeBaskets.pop_back();
+        *basket = ActionBasket(action, relevance, skipPrerequisites, event);
     }
+
+    heap.push_back({basket, sequence++});
+    positions[action->getId()] = heap.size() - 1;
+    SiftUp(heap.size() - 1);
 }
 
 ActionNode* Queue::Pop()
 {
-    float max = -1;
-    ActionBasket* selection = nullptr;
+    if (recordedQueue.load(std::memory_order_relaxed) == this)
+        RecordOperation("", 0.0f);
+
+    ActionBasket* selection = Peek();
+    if (!selection)
+        return nullptr;
+
+    ActionNode* action = selection->getAction();
+    Remove(0);
+    ReleaseBasket(selection);
+    return action;
+}
+
+ActionBasket* Queue::Peek()
+{
+    if (heap.empty() || heap.front().basket->getRelevance() <= -1)
+        return nullptr;
 
-    for (std::list<ActionBasket*>::iterator iter = actions.begin(); iter != actions.end(); iter++)
+    return heap.front().basket;
+}
+
+uint32 Queue::Size() { return heap.size(); }
+
+void Queue::RemoveExpired()
+{
+    if (!sPlayerbotAIConfig->expireActionTime)
+        return;
+
+    for (uint32 i = heap.size(); i > 0; --i)
     {
-        ActionBasket* basket = *iter;
-        if (basket->getRelevance() > max)
-        {
-            max = basket->getRelevance();
-            selection = basket;
-        }
+        ActionBasket* basket = heap[i - 1].basket;
+        if (!basket->isExpired(sPlayerbotAIConfig->expireActionTime))
+            continue;
+
+        Remove(i - 1);
+        ReleaseBasket(basket);
     }
+}
 
-    if (selection != nullptr)
+bool Queue::IsBefore(Entry const& left, Entry const& right) const
+{
+    float leftRelevance = left.basket->getRelevance();
+    float rightRelevance = right.basket->getRelevance();
+    if (leftRelevance != rightRelevance)
+        return leftRelevance > rightRelevance;
+
+    return left.sequence < right.sequence;
+}
+
+void Queue::Swap(uint32 left, uint32 right)
+{
+    std::swap(heap[left], heap[right]);
+    positions[heap[left].basket->getAction()->getId()] = left;
+    positions[heap[right].basket->getAction()->getId()] = right;
+}
+
+void Queue::SiftUp(uint32 index)
+{
+    while (index > 0)
     {
-        ActionNode* action = selection->getAction();
-        actions.remove(selection);
-        delete selection;
-        return action;
+        uint32 parent = (index - 1) / 2;
+        if (!IsBefore(heap[index], heap[parent]))
+            break;
+
+        Swap(index, parent);
+        index = parent;
     }
+}
+
+void Queue::SiftDown(uint32 index)
+{
+    while (true)
+    {
+        uint32 first = index;
+        uint32 left = index * 2 + 1;
+        uint32 right = left + 1;
+
+        if (left < heap.size() && IsBefore(heap[left], heap[first]))
+            first = left;
 
-    return nullptr;
+        if (right < heap.size() && IsBefore(heap[right], heap[first]))
+            first = right;
+
+        if (first == index)
+            break;
+
+        Swap(index, first);
+        index = first;
+    }
 }
 
-ActionBasket* Queue::Peek()
+void Queue::Remove(uint32 index)
 {
-    float max = -1;
-    ActionBasket* selection = nullptr;
-    for (std::list<ActionBasket*>::iterator iter = actions.begin(); iter != actions.end(); iter++)
+    positions.erase(heap[index].basket->getAction()->getId());
+
+    uint32 last = heap.size() - 1;
+    if (index != last)
     {
-        ActionBasket* basket = *iter;
-        if (basket->getRelevance() > max)
-        {
-            max = basket->getRelevance();
-            selection = basket;
-        }
+        heap[index] = heap[last];
+        positions[heap[index].basket->getAction()->getId()] = index;
     }
 
-    return selection;
+    heap.pop_back();
+
+    if (index < heap.size())
+    {
+        SiftUp(index);
+        SiftDown(index);
+    }
 }
 
-uint32 Queue::Size() { return actions.size(); }
+void Queue::ReleaseBasket(ActionBasket* basket)
+{
+    // drop the event payload now, the basket itself is kept for the next push
+    *basket = ActionBasket(nullptr, 0.0f, false, Event());
+    freeBaskets.push_back(basket);
+}
 
-void Queue::RemoveExpired()
+void Queue::RecordOperation(std::string const& action, float relevance)
+{
+    std::lock_guard<std::mutex> guard(recordLock);
+    if (recordedQueue != this || recordedOperations.size() >= recordLimit)
+        return;
+
+    recordedOperations.push_back({action, relevance});
+    if (recordedOperations.size() >= recordLimit)
+        recordedQueue = nullptr;
+}
+
+void Queue::Record(Queue* queue, uint32 operations)
+{
+    std::lock_guard<std::mutex> guard(recordLock);
+    recordedOperations.clear();
+    recordedOperations.reserve(operations);
+    recordLimit = operations;
+    recordedQueue = queue;
+}
+
+bool Queue::TakeRecording(std::vector<QueueOperation>& operations, uint32& recorded, uint32& limit)
+{
+    std::lock_guard<std::mutex> guard(recordLock);
+    recorded = recordedOperations.size();
+    limit = recordLimit;
+    if (!recordLimit || recorded < recordLimit)
+        return false;
+
+    operations.swap(recordedOperations);
+    recordedOperations.clear();
+    recordLimit = 0;
+    return true;
+}
+
+void Queue::Benchmark(std::vector<QueueOperation> const& operations)
 {
-    std::list<ActionBasket*> expired;
-    for (std::list<ActionBasket*>::iterator iter = actions.begin(); iter != actions.end(); iter++)
+    // the replay pushes the nodes the engine would have cached for the recorded actions
+    std::unordered_map<std::string, ActionNode*> nodes;
+    for (QueueOperation const& operation : operations)
     {
-        ActionBasket* basket = *iter;
-        if (sPlayerbotAIConfig->expireActionTime && basket->isExpired(sPlayerbotAIConfig->expireActionTime))
-            expired.push_back(basket);
+        if (!operation.action.empty() && nodes.find(operation.action) == nodes.end())
+            nodes[operation.action] = new ActionNode(operation.action);
     }
 
-    for (std::list<ActionBasket*>::iterator iter = expired.begin(); iter != expired.end(); iter++)
+    uint32 pushes = 0;
+    uint32 pops = 0;
+    uint64 heapElapsed = 0;
     {
-        ActionBasket* basket = *iter;
-        actions.remove(basket);
+        Queue queue;
+        auto started = std::chrono::steady_clock::now();
+        for (QueueOperation const& operation : operations)
+        {
+            if (operation.action.empty())
+            {
+                if (queue.Pop())
+                    ++pops;
+            }
+            else
+            {
+                queue.Push(nodes[operation.action], operation.relevance, false, Event());
+                ++pushes;
+            }
+        }
+
+        heapElapsed =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - started).count();
+    }
 
-        if (ActionNode* action = basket->getAction())
+    // the list the queue replaced: names compared on every push, the best basket searched on every pop
+    uint64 listElapsed = 0;
+    {
+        std::list<ActionBasket*> actions;
+        auto started = std::chrono::steady_clock::now();
+        for (QueueOperation const& operation : operations)
         {
-            delete action;
+            if (operation.action.empty())
+            {
+                float max = -1;
+                ActionBasket* selection = nullptr;
+                for (ActionBasket* basket : actions)
+                {
+                    if (basket->getRelevance() > max)
+                    {
+                        max = basket->getRelevance();
+                        selection = basket;
+                    }
+                }
+
+                if (selection)
+                {
+                    actions.remove(selection);
+                    delete selection;
+                }
+
+                continue;
+            }
+
+            ActionBasket* action =
+                new ActionBasket(nodes[operation.action], operation.relevance, false, Event());
+            bool queued = false;
+            for (ActionBasket* basket : actions)
+            {
+                if (action->getAction()->getName() == basket->getAction()->getName())
+                {
+                    if (basket->getRelevance() < action->getRelevance())
+                        basket->setRelevance(action->getRelevance());
+
+                    delete action;
+                    queued = true;
+                    break;
+                }
+            }
+
+            if (!queued)
+                actions.push_back(action);
         }
 
-        delete basket;
+        listElapsed =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - started).count();
+
+        for (ActionBasket* basket : actions)
+            delete basket;
     }
+
+    for (auto const& itr : nodes)
+        delete itr.second;
+
+    LOG_INFO("playerbots", "Queue benchmark: replayed {} pushes and {} pops of {} actions", pushes, pops,
+             nodes.size());
+    LOG_INFO("playerbots", "Queue benchmark: list {} us, heap {} us", listElapsed / 1000, heapElapsed / 1000);
 }
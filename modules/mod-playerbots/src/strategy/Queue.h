@@ -6,23 +6,62 @@
 #ifndef _PLAYERBOT_QUEUE_H
 #define _PLAYERBOT_QUEUE_H
 
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include "Action.h"
 #include "Common.h"
 
+// Push or pop of a recorded queue, pops have no action name
+struct QueueOperation
+{
+    std::string action;
+    float relevance;
+};
+
+// Binary max heap of action baskets ordered by relevance, baskets of equal relevance keep their push order.
+// The action nodes are owned by the engine.
 class Queue
 {
 public:
-    Queue(void) {}
-    ~Queue(void) {}
+    Queue(void) : sequence(0) {}
+    ~Queue(void);
 
-    void Push(ActionBasket* action);
+    void Push(ActionNode* action, float relevance, bool skipPrerequisites, Event event);
     ActionNode* Pop();
     ActionBasket* Peek();
     uint32 Size();
     void RemoveExpired();
 
+    // records the next pushes and pops of the queue, a new recording replaces the previous one
+    static void Record(Queue* queue, uint32 operations);
+    // hands out the operations once the recording is complete, otherwise tells how far it got
+    static bool TakeRecording(std::vector<QueueOperation>& operations, uint32& recorded, uint32& limit);
+    // replays recorded operations on this queue and on the list based queue the engine used before
+    static void Benchmark(std::vector<QueueOperation> const& operations);
+
 private:
-    std::list<ActionBasket*> actions;
+    struct Entry
+    {
+        ActionBasket* basket;
+        uint32 sequence;
+    };
+
+    bool IsBefore(Entry const& left, Entry const& right) const;
+    void Swap(uint32 left, uint32 right);
+    void SiftUp(uint32 index);
+    void SiftDown(uint32 index);
+    void Remove(uint32 index);
+    void ReleaseBasket(ActionBasket* basket);
+    void RecordOperation(std::string const& action, float relevance);
+
+    std::vector<Entry> heap;
+    // position of every queued action in the heap by action node id
+    std::unordered_map<uint32, uint32> positions;
+    // baskets of popped actions, reused by the next pushes
+    std::vector<ActionBasket*> freeBaskets;
+    uint32 sequence;
 };
 
 #endif
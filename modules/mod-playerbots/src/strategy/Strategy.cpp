@@ -117,7 +117,7 @@ private:
 
 Strategy::Strategy(PlayerbotAI* botAI) : PlayerbotAIAware(botAI)
 {
-    actionNodeFactories.Add(new ActionNodeFactoryInternal());
+    actionNodeFactories.Add<ActionNodeFactoryInternal>();
 }
 
 ActionNode* Strategy::GetAction(std::string const name) { return actionNodeFactories.GetContextObject(name, botAI); }
@@ -21,7 +21,10 @@ public:
 
     virtual Event Check();
     virtual void ExternalEvent([[maybe_unused]] std::string const param, [[maybe_unused]] Player* owner = nullptr) {}
-    virtual void ExternalEvent([[maybe_unused]] WorldPacket& packet, [[maybe_unused]] Player* owner = nullptr) {}
+    virtual void ExternalEvent([[maybe_unused]] std::shared_ptr<WorldPacket const> const& packet,
+                               [[maybe_unused]] Player* owner = nullptr)
+    {
+    }
     virtual bool IsActive() { return false; }
     virtual NextAction** getHandlers() { return nullptr; }
     void Update() {}
@@ -29,8 +32,14 @@ public:
     virtual Unit* GetTarget();
     virtual Value<Unit*>* GetTargetValue();
     virtual std::string const GetTargetName() { return "self target"; }
+    // active only after an ExternalEvent, so the engine checks it when events reached the bot
+    virtual bool IsEventDriven() { return false; }
+    // only reads the bot, its target and its group, so the parallel bot update may check it on a worker thread
+    virtual bool IsParallelSafe() { return false; }
 
     bool needCheck();
+    int32 getCheckInterval() { return checkInterval; }
+    uint32 getLastCheckTime() { return lastCheckTime; }
 
 protected:
     int32 checkInterval;
@@ -52,8 +61,15 @@ public:
     std::string const getName() { return name; }
 
     NextAction** getHandlers() { return NextAction::merge(NextAction::clone(handlers), trigger->getHandlers()); }
+    // the node's own handlers unless the trigger adds to them, then a merged copy the caller owns and deletes
+    NextAction** getHandlers(bool& owned)
+    {
+        NextAction** added = trigger->getHandlers();
+        owned = added != nullptr;
+        return owned ? NextAction::merge(NextAction::clone(handlers), added) : handlers;
+    }
 
-    float getFirstRelevance() { return handlers[0] ? handlers[0]->getRelevance() : -1; }
+    float getFirstRelevance() { return handlers && handlers[0] ? handlers[0]->getRelevance() : -1; }
 
 private:
     Trigger* trigger;
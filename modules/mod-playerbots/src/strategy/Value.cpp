@@ -123,11 +123,8 @@ Unit* UnitCalculatedValue::Get()
 {
     if (checkInterval < 2)
     {
-        PerformanceMonitorOperation* pmo = sPerformanceMonitor->start(
-            PERF_MON_VALUE, this->getName(), this->context ? &this->context->performanceStack : nullptr);
+        PerformanceMonitorScope pms(PERF_MON_VALUE, this, this->context ? &this->context->performanceStack : nullptr);
         value = Calculate();
-        if (pmo)
-            pmo->finish();
     }
     else
     {
@@ -135,11 +132,9 @@ Unit* UnitCalculatedValue::Get()
         if (!lastCheckTime || now - lastCheckTime >= checkInterval)
         {
             lastCheckTime = now;
-            PerformanceMonitorOperation* pmo = sPerformanceMonitor->start(
-                PERF_MON_VALUE, this->getName(), this->context ? &this->context->performanceStack : nullptr);
+            PerformanceMonitorScope pms(PERF_MON_VALUE, this,
+                                        this->context ? &this->context->performanceStack : nullptr);
             value = Calculate();
-            if (pmo)
-                pmo->finish();
         }
     }
     // Prevent crashing by InWorld check
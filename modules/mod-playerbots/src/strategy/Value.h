@@ -154,11 +154,9 @@ public:
         {
             this->lastCheckTime = now;
 
-            PerformanceMonitorOperation* pmo = sPerformanceMonitor->start(
-                PERF_MON_VALUE, this->getName(), this->context ? &this->context->performanceStack : nullptr);
+            PerformanceMonitorScope pms(PERF_MON_VALUE, this,
+                                        this->context ? &this->context->performanceStack : nullptr);
             this->value = this->Calculate();
-            if (pmo)
-                pmo->finish();
         }
 
         return this->value;
@@ -86,7 +86,7 @@ bool AttackAction::Attack(Unit* target, bool with_pet /*true*/)
         return false;
     }
 
-    if (!bot->IsWithinLOSInMap(target))
+    if (!sServerFacade->IsWithinLOSInMap(bot, target))
     {
         msg << " is not on my sight";
         if (verbose)
@@ -157,7 +157,7 @@ bool GoAction::Execute(Event event)
             botAI->TellMaster(out);
         }
 
-        if (bot->IsWithinLOS(x, y, z))
+        if (sServerFacade->IsWithinLOS(bot, x, y, z))
             return MoveNear(bot->GetMapId(), x, y, z, 0);
         else
             return MoveTo(bot->GetMapId(), x, y, z, false, false);
@@ -10,6 +10,7 @@
 #include "Event.h"
 #include "LastMovementValue.h"
 #include "Playerbots.h"
+#include "ServerFacade.h"
 
 bool MoveToRpgTargetAction::Execute(Event event)
 {
@@ -79,7 +80,7 @@ bool MoveToRpgTargetAction::Execute(Event event)
 
     float angle = 0.f;
     float distance = 1.0f;
-    if (bot->IsWithinLOS(x, y, z))
+    if (sServerFacade->IsWithinLOS(bot, x, y, z))
     {
         if (!unit || !unit->isMoving())
             angle = wo->GetAngle(bot) + (M_PI * irand(-25, 25) / 100.0);  // Closest 45 degrees towards the target
@@ -9,6 +9,7 @@
 #include "LootObjectStack.h"
 #include "PathGenerator.h"
 #include "Playerbots.h"
+#include "ServerFacade.h"
 
 bool MoveToTravelTargetAction::Execute(Event event)
 {
@@ -98,7 +99,7 @@ bool MoveToTravelTargetAction::Execute(Event event)
 
     bool canMove = false;
 
-    if (bot->IsWithinLOS(x, y, z))
+    if (sServerFacade->IsWithinLOS(bot, x, y, z))
         canMove = MoveNear(mapId, x, y, z, 0);
     else
         canMove = MoveTo(mapId, x, y, z, false, false);
@@ -111,7 +111,7 @@ bool MovementAction::MoveNear(WorldObject* target, float distance, MovementPrior
         float y = target->GetPositionY() + sin(angle) * distance;
         float z = target->GetPositionZ();
 
-        if (!bot->IsWithinLOS(x, y, z))
+        if (!sServerFacade->IsWithinLOS(bot, x, y, z))
             continue;
 
         bool moved = MoveTo(target->GetMapId(), x, y, z, false, false, false, false, priority);
@@ -156,7 +156,8 @@ bool MovementAction::MoveToLOS(WorldObject* target, bool ranged)
                 CreateWp(bot, point.x, point.y, point.z, 0.0, 2334);
 
             float distPoint = target->GetDistance(point.x, point.y, point.z);
-            if (distPoint < dist && target->IsWithinLOS(point.x, point.y, point.z + bot->GetCollisionHeight()))
+            if (distPoint < dist &&
+                sServerFacade->IsWithinLOS(target, point.x, point.y, point.z + bot->GetCollisionHeight()))
             {
                 dist = distPoint;
                 dest.Set(point.x, point.y, point.z, target->GetMapId());
@@ -1394,7 +1395,7 @@ bool MovementAction::Flee(Unit* target)
                     float distanceToTarget = sServerFacade->GetDistance2d(player, target);
                     if (distanceToHealer < fleeDistance &&
                         distanceToTarget > (botAI->GetRange("shoot") / 2 + sPlayerbotAIConfig->followDistance) &&
-                        (needHealer || player->IsWithinLOSInMap(target)))
+                        (needHealer || sServerFacade->IsWithinLOSInMap(player, target)))
                     {
                         fleeTarget = player;
                         fleeDistance = distanceToHealer;
@@ -1407,7 +1408,7 @@ bool MovementAction::Flee(Unit* target)
                     float distanceToTarget = sServerFacade->GetDistance2d(player, target);
                     if (distanceToRanged < fleeDistance &&
                         distanceToTarget > (botAI->GetRange("shoot") / 2 + sPlayerbotAIConfig->followDistance) &&
-                        player->IsWithinLOSInMap(target))
+                        sServerFacade->IsWithinLOSInMap(player, target))
                     {
                         fleeTarget = player;
                         fleeDistance = distanceToRanged;
@@ -1419,7 +1420,7 @@ bool MovementAction::Flee(Unit* target)
                 float distanceToTarget = sServerFacade->GetDistance2d(player, target);
                 if (distanceToFlee < spareDistance &&
                     distanceToTarget > (botAI->GetRange("shoot") / 2 + sPlayerbotAIConfig->followDistance) &&
-                    player->IsWithinLOSInMap(target))
+                    sServerFacade->IsWithinLOSInMap(player, target))
                 {
                     spareTarget = player;
                     spareDistance = distanceToFlee;
@@ -1436,7 +1437,8 @@ bool MovementAction::Flee(Unit* target)
             if (fleeTarget)
                 foundFlee = MoveNear(fleeTarget);
 
-            if ((!fleeTarget || !foundFlee) && master && master->IsAlive() && master->IsWithinLOSInMap(target))
+            if ((!fleeTarget || !foundFlee) && master && master->IsAlive() &&
+                sServerFacade->IsWithinLOSInMap(master, target))
             {
                 float distanceToTarget = sServerFacade->GetDistance2d(master, target);
                 if (distanceToTarget > (botAI->GetRange("shoot") / 2 + sPlayerbotAIConfig->followDistance))
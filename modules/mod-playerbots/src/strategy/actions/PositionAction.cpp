@@ -8,6 +8,7 @@
 #include "Event.h"
 #include "Playerbots.h"
 #include "PositionValue.h"
+#include "ServerFacade.h"
 
 void TellPosition(PlayerbotAI* botAI, std::string const name, PositionInfo pos)
 {
@@ -137,7 +138,7 @@ bool SetReturnPositionAction::Execute(Event event)
         float z = bot->GetPositionZ();
         bot->UpdateAllowedPositionZ(x, y, z);
 
-        if (!bot->IsWithinLOS(x, y, z))
+        if (!sServerFacade->IsWithinLOS(bot, x, y, z))
             return false;
 
         randomPos.Set(x, y, z, bot->GetMapId());
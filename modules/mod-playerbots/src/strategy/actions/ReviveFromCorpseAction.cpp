@@ -342,7 +342,7 @@ bool SpiritHealerAction::Execute(Event event)
 
     bool moved = false;
 
-    if (bot->IsWithinLOS(ClosestGrave->x, ClosestGrave->y, ClosestGrave->z))
+    if (sServerFacade->IsWithinLOS(bot, ClosestGrave->x, ClosestGrave->y, ClosestGrave->z))
         moved = MoveNear(ClosestGrave->Map, ClosestGrave->x, ClosestGrave->y, ClosestGrave->z, 0.0);
     else
         moved = MoveTo(ClosestGrave->Map, ClosestGrave->x, ClosestGrave->y, ClosestGrave->z, false, false);
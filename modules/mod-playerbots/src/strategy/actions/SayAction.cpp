@@ -12,48 +12,10 @@
 #include "ChannelMgr.h"
 #include "Event.h"
 #include "GuildMgr.h"
+#include "PlayerbotChatMessage.h"
 #include "PlayerbotTextMgr.h"
 #include "Playerbots.h"
 
-static const std::unordered_set<std::string> noReplyMsgs = {
-    "join",
-    "leave",
-    "follow",
-    "attack",
-    "pull",
-    "flee",
-    "reset",
-    "reset ai",
-    "all ?",
-    "talents",
-    "talents list",
-    "talents auto",
-    "talk",
-    "stay",
-    "stats",
-    "who",
-    "items",
-    "leave",
-    "join",
-    "repair",
-    "summon",
-    "nc ?",
-    "co ?",
-    "de ?",
-    "dead ?",
-    "follow",
-    "los",
-    "guard",
-    "do accept invitation",
-    "stats",
-    "react ?",
-    "reset strats",
-    "home",
-};
-static const std::unordered_set<std::string> noReplyMsgParts = {
-    "+", "-", "@", "follow target", "focus heal", "cast ", "accept [", "e [", "destroy [", "go zone"};
-static const std::unordered_set<std::string> noReplyMsgStarts = {"e ", "accept ", "cast ", "destroy "};
-
 SayAction::SayAction(PlayerbotAI* botAI) : Action(botAI, "say"), Qualified() {}
 
 bool SayAction::Execute(Event event)
@@ -157,74 +119,46 @@ bool SayAction::isUseful()
     return (time(nullptr) - lastSaid) > 30;
 }
 
-void ChatReplyAction::ChatReplyDo(Player* bot, uint32& type, uint32& guid1, uint32& guid2, std::string& msg, std::string& chanName, std::string& name)
+void ChatReplyAction::ChatReplyDo(Player* bot, uint32& type, uint32& guid1, uint32& guid2,
+                                  PlayerbotChatMessage const& message, std::string& chanName, std::string& name)
 {
-    ChatReplyType replyType = REPLY_NOT_UNDERSTAND;  // default not understand
-    std::string respondsText = "";
-
     // if we're just commanding bots around, don't respond...
-    // first one is for exact word matches
-    if (noReplyMsgs.find(msg) != noReplyMsgs.end())
-    {
-        /*std::ostringstream out;
-        out << "DEBUG ChatReplyDo decided to ignore exact blocklist match" << msg;
-        bot->Say(out.str(), LANG_UNIVERSAL);*/
-        return;
-    }
-
-    // second one is for partial matches like + or - where we change strats
-    if (std::any_of(noReplyMsgParts.begin(), noReplyMsgParts.end(),
-                    [&msg](const std::string& part) { return msg.find(part) != std::string::npos; }))
-    {
-        /*std::ostringstream out;
-        out << "DEBUG ChatReplyDo decided to ignore partial blocklist match" << msg;
-        bot->Say(out.str(), LANG_UNIVERSAL);*/
-        return;
-    }
-
-    if (std::any_of(noReplyMsgStarts.begin(), noReplyMsgStarts.end(),
-                    [&msg](const std::string& start)
-                    {
-                        return msg.find(start) == 0;  // Check if the start matches the beginning of msg
-                    }))
-    {
-        /*std::ostringstream out;
-        out << "DEBUG ChatReplyDo decided to ignore start blocklist match" << msg;
-        bot->Say(out.str(), LANG_UNIVERSAL);*/
+    if (message.IsReplyBlocked())
         return;
-    }
 
+    std::string const& msg = message.GetText();
     ChatChannelSource chatChannelSource = GET_PLAYERBOT_AI(bot)->GetChatChannelSource(bot, type, chanName);
-    if ( (msg.starts_with("LFG") || msg.starts_with("LFM")) && HandleLFGQuestsReply(bot, chatChannelSource, msg, name))
+    if ((msg.starts_with("LFG") || msg.starts_with("LFM")) &&
+        HandleLFGQuestsReply(bot, chatChannelSource, message, name))
     {
         return;
     }
 
-    if (msg.starts_with("WTB") && HandleWTBItemsReply(bot, chatChannelSource, msg, name))
+    if (msg.starts_with("WTB") && HandleWTBItemsReply(bot, chatChannelSource, message, name))
     {
         return;
     }
 
     //toxic links
-    if (msg.starts_with(sPlayerbotAIConfig->toxicLinksPrefix)
-        && (GET_PLAYERBOT_AI(bot)->GetChatHelper()->ExtractAllItemIds(msg).size() > 0 || GET_PLAYERBOT_AI(bot)->GetChatHelper()->ExtractAllQuestIds(msg).size() > 0))
+    if (message.IsToxicLinks())
     {
-        HandleToxicLinksReply(bot, chatChannelSource, msg, name);
+        HandleToxicLinksReply(bot, chatChannelSource, message, name);
         return;
     }
 
     //thunderfury
-    if (GET_PLAYERBOT_AI(bot)->GetChatHelper()->ExtractAllItemIds(msg).count(19019))
+    if (message.GetItemIds().count(19019))
     {
-        HandleThunderfuryReply(bot, chatChannelSource, msg, name);
+        HandleThunderfuryReply(bot, chatChannelSource, message, name);
         return;
     }
 
-    auto messageRepy = GenerateReplyMessage(bot, msg, guid1, name);
+    auto messageRepy = GenerateReplyMessage(bot, message, guid1, name);
     SendGeneralResponse(bot, chatChannelSource, messageRepy, name);
 }
 
-bool ChatReplyAction::HandleThunderfuryReply(Player* bot, ChatChannelSource chatChannelSource, std::string& msg, std::string& name)
+bool ChatReplyAction::HandleThunderfuryReply(Player* bot, ChatChannelSource chatChannelSource,
+                                             PlayerbotChatMessage const& message, std::string& name)
 {
     std::map<std::string, std::string> placeholders;
     const auto thunderfury = sObjectMgr->GetItemTemplate(19019);
@@ -252,7 +186,8 @@ bool ChatReplyAction::HandleThunderfuryReply(Player* bot, ChatChannelSource chat
     return true;
 }
 
-bool ChatReplyAction::HandleToxicLinksReply(Player* bot, ChatChannelSource chatChannelSource, std::string& msg, std::string& name)
+bool ChatReplyAction::HandleToxicLinksReply(Player* bot, ChatChannelSource chatChannelSource,
+                                            PlayerbotChatMessage const& message, std::string& name)
 {
     //quests
     std::vector<uint32> incompleteQuests;
@@ -318,9 +253,10 @@ bool ChatReplyAction::HandleToxicLinksReply(Player* bot, ChatChannelSource chatC
 
     return true;
 }
-bool ChatReplyAction::HandleWTBItemsReply(Player* bot, ChatChannelSource chatChannelSource, std::string& msg, std::string& name)
+bool ChatReplyAction::HandleWTBItemsReply(Player* bot, ChatChannelSource chatChannelSource,
+                                          PlayerbotChatMessage const& message, std::string& name)
 {
-    auto messageItemIds = GET_PLAYERBOT_AI(bot)->GetChatHelper()->ExtractAllItemIds(msg);
+    std::set<uint32> const& messageItemIds = message.GetItemIds();
 
     if (messageItemIds.empty())
     {
@@ -413,9 +349,10 @@ bool ChatReplyAction::HandleWTBItemsReply(Player* bot, ChatChannelSource chatCha
 
     return true;
 }
-bool ChatReplyAction::HandleLFGQuestsReply(Player* bot, ChatChannelSource chatChannelSource, std::string& msg, std::string& name)
+bool ChatReplyAction::HandleLFGQuestsReply(Player* bot, ChatChannelSource chatChannelSource,
+                                           PlayerbotChatMessage const& message, std::string& name)
 {
-    auto messageQuestIds = GET_PLAYERBOT_AI(bot)->GetChatHelper()->ExtractAllQuestIds(msg);
+    std::set<uint32> const& messageQuestIds = message.GetQuestIds();
 
     if (messageQuestIds.empty())
     {
@@ -575,8 +512,10 @@ bool ChatReplyAction::SendGeneralResponse(Player* bot, ChatChannelSource chatCha
     return true;
 }
 
-std::string ChatReplyAction::GenerateReplyMessage(Player* bot, std::string& incomingMessage, uint32& guid1, std::string& name)
+std::string ChatReplyAction::GenerateReplyMessage(Player* bot, PlayerbotChatMessage const& message, uint32& guid1,
+                                                  std::string& name)
 {
+    std::string const& incomingMessage = message.GetText();
     ChatReplyType replyType = REPLY_NOT_UNDERSTAND; // default not understand
 
     std::string respondsText = "";
@@ -586,19 +525,7 @@ std::string ChatReplyAction::GenerateReplyMessage(Player* bot, std::string& inco
     int32 verb_type = -1;
     int32 is_quest = 0;
     bool found = false;
-    std::stringstream text(incomingMessage);
-    std::string segment;
-    std::vector<std::string> word;
-    while (std::getline(text, segment, ' '))
-    {
-        word.push_back(segment);
-    }
-
-    for (uint32 i = 0; i < 15; i++)
-    {
-        if (word.size() < i)
-            word.push_back("");
-    }
+    std::vector<std::string> const& word = message.GetWords();
 
     if (incomingMessage.find("?") != std::string::npos)
         is_quest = 1;
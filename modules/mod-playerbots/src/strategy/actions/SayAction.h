@@ -11,6 +11,7 @@
 #include "NamedObjectContext.h"
 
 class PlayerbotAI;
+class PlayerbotChatMessage;
 class SayAction : public Action, public Qualified
 {
 public:
@@ -32,12 +33,18 @@ public:
     virtual bool Execute(Event event) { return true; }
     bool isUseful() { return true; }
 
-    static void ChatReplyDo(Player* bot, uint32& type, uint32& guid1, uint32& guid2, std::string& msg, std::string& chanName, std::string& name);
-    static bool HandleThunderfuryReply(Player* bot, ChatChannelSource chatChannelSource, std::string& msg, std::string& name);
-    static bool HandleToxicLinksReply(Player* bot, ChatChannelSource chatChannelSource, std::string& msg, std::string& name);
-    static bool HandleWTBItemsReply(Player* bot, ChatChannelSource chatChannelSource, std::string& msg, std::string& name);
-    static bool HandleLFGQuestsReply(Player* bot, ChatChannelSource chatChannelSource, std::string& msg, std::string& name);
+    static void ChatReplyDo(Player* bot, uint32& type, uint32& guid1, uint32& guid2,
+                            PlayerbotChatMessage const& message, std::string& chanName, std::string& name);
+    static bool HandleThunderfuryReply(Player* bot, ChatChannelSource chatChannelSource,
+                                       PlayerbotChatMessage const& message, std::string& name);
+    static bool HandleToxicLinksReply(Player* bot, ChatChannelSource chatChannelSource,
+                                      PlayerbotChatMessage const& message, std::string& name);
+    static bool HandleWTBItemsReply(Player* bot, ChatChannelSource chatChannelSource,
+                                    PlayerbotChatMessage const& message, std::string& name);
+    static bool HandleLFGQuestsReply(Player* bot, ChatChannelSource chatChannelSource,
+                                     PlayerbotChatMessage const& message, std::string& name);
     static bool SendGeneralResponse(Player* bot, ChatChannelSource chatChannelSource, std::string& responseMessage, std::string& name);
-    static std::string GenerateReplyMessage(Player* bot, std::string& incomingMessage, uint32& guid1, std::string& name);
+    static std::string GenerateReplyMessage(Player* bot, PlayerbotChatMessage const& message, uint32& guid1,
+                                            std::string& name);
 };
 #endif
@@ -11,6 +11,7 @@
 #include "Playerbots.h"
 #include "RTSCValues.h"
 #include "RtscAction.h"
+#include "ServerFacade.h"
 
 Creature* SeeSpellAction::CreateWps(Player* wpOwner, float x, float y, float z, float o, uint32 entry, Creature* lastWp,
                                     bool important)
@@ -123,7 +124,7 @@ bool SeeSpellAction::MoveToSpell(WorldPosition& spellPosition, bool inFormation)
     if (inFormation)
         SetFormationOffset(spellPosition);
 
-    if (bot->IsWithinLOS(spellPosition.getX(), spellPosition.getY(), spellPosition.getZ()))
+    if (sServerFacade->IsWithinLOS(bot, spellPosition.getX(), spellPosition.getY(), spellPosition.getZ()))
         return MoveNear(spellPosition.getMapId(), spellPosition.getX(), spellPosition.getY(), spellPosition.getZ(), 0);
 
     return MoveTo(spellPosition.getMapId(), spellPosition.getX(), spellPosition.getY(), spellPosition.getZ(), false,
@@ -11,6 +11,7 @@
 #include "GridNotifiersImpl.h"
 #include "PlayerbotAIConfig.h"
 #include "Playerbots.h"
+#include "ServerFacade.h"
 
 bool UseMeetingStoneAction::Execute(Event event)
 {
@@ -185,7 +186,7 @@ bool SummonAction::Teleport(Player* summoner, Player* player)
             float y = summoner->GetPositionY() + sin(angle) * sPlayerbotAIConfig->followDistance;
             float z = summoner->GetPositionZ();
 
-            if (summoner->IsWithinLOS(x, y, z))
+            if (sServerFacade->IsWithinLOS(summoner, x, y, z))
             {
                 if (sPlayerbotAIConfig
                         ->botRepairWhenSummon)  // .conf option to repair bot gear when summoned 0 = off, 1 = on
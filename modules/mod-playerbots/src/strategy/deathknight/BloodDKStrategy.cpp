@@ -76,7 +76,7 @@ private:
 
 BloodDKStrategy::BloodDKStrategy(PlayerbotAI* botAI) : GenericDKStrategy(botAI)
 {
-    actionNodeFactories.Add(new BloodDKStrategyActionNodeFactory());
+    actionNodeFactories.Add<BloodDKStrategyActionNodeFactory>();
 }
 
 NextAction** BloodDKStrategy::getDefaultActions()
@@ -265,9 +265,9 @@ private:
 
 DKAiObjectContext::DKAiObjectContext(PlayerbotAI* botAI) : AiObjectContext(botAI)
 {
-    strategyContexts.Add(new DeathKnightStrategyFactoryInternal());
-    strategyContexts.Add(new DeathKnightCombatStrategyFactoryInternal());
-    strategyContexts.Add(new DeathKnightDKBuffStrategyFactoryInternal());
-    actionContexts.Add(new DeathKnightAiObjectContextInternal());
-    triggerContexts.Add(new DeathKnightTriggerFactoryInternal());
+    strategyContexts.Add<DeathKnightStrategyFactoryInternal>();
+    strategyContexts.Add<DeathKnightCombatStrategyFactoryInternal>();
+    strategyContexts.Add<DeathKnightDKBuffStrategyFactoryInternal>();
+    actionContexts.Add<DeathKnightAiObjectContextInternal>();
+    triggerContexts.Add<DeathKnightTriggerFactoryInternal>();
 }
@@ -81,7 +81,7 @@ private:
 
 FrostDKStrategy::FrostDKStrategy(PlayerbotAI* botAI) : GenericDKStrategy(botAI)
 {
-    actionNodeFactories.Add(new FrostDKStrategyActionNodeFactory());
+    actionNodeFactories.Add<FrostDKStrategyActionNodeFactory>();
 }
 
 NextAction** FrostDKStrategy::getDefaultActions()
@@ -36,7 +36,7 @@ private:
 
 GenericDKNonCombatStrategy::GenericDKNonCombatStrategy(PlayerbotAI* botAI) : NonCombatStrategy(botAI)
 {
-    actionNodeFactories.Add(new GenericDKNonCombatStrategyActionNodeFactory());
+    actionNodeFactories.Add<GenericDKNonCombatStrategyActionNodeFactory>();
 }
 
 void GenericDKNonCombatStrategy::InitTriggers(std::vector<TriggerNode*>& triggers)
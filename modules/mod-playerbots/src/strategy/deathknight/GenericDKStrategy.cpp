@@ -158,7 +158,7 @@ private:
 
 GenericDKStrategy::GenericDKStrategy(PlayerbotAI* botAI) : MeleeCombatStrategy(botAI)
 {
-    actionNodeFactories.Add(new GenericDKStrategyActionNodeFactory());
+    actionNodeFactories.Add<GenericDKStrategyActionNodeFactory>();
 }
 
 void GenericDKStrategy::InitTriggers(std::vector<TriggerNode*>& triggers)
@@ -72,7 +72,7 @@ private:
 
 UnholyDKStrategy::UnholyDKStrategy(PlayerbotAI* botAI) : GenericDKStrategy(botAI)
 {
-    actionNodeFactories.Add(new UnholyDKStrategyActionNodeFactory());
+    actionNodeFactories.Add<UnholyDKStrategyActionNodeFactory>();
 }
 
 NextAction** UnholyDKStrategy::getDefaultActions()
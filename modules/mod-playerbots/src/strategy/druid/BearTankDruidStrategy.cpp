@@ -136,7 +136,7 @@ private:
 
 BearTankDruidStrategy::BearTankDruidStrategy(PlayerbotAI* botAI) : FeralDruidStrategy(botAI)
 {
-    actionNodeFactories.Add(new BearTankDruidStrategyActionNodeFactory());
+    actionNodeFactories.Add<BearTankDruidStrategyActionNodeFactory>();
 }
 
 NextAction** BearTankDruidStrategy::getDefaultActions()
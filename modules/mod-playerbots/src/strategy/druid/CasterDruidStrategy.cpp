@@ -109,8 +109,8 @@ private:
 
 CasterDruidStrategy::CasterDruidStrategy(PlayerbotAI* botAI) : GenericDruidStrategy(botAI)
 {
-    actionNodeFactories.Add(new CasterDruidStrategyActionNodeFactory());
-    actionNodeFactories.Add(new ShapeshiftDruidStrategyActionNodeFactory());
+    actionNodeFactories.Add<CasterDruidStrategyActionNodeFactory>();
+    actionNodeFactories.Add<ShapeshiftDruidStrategyActionNodeFactory>();
 }
 
 NextAction** CasterDruidStrategy::getDefaultActions()
@@ -117,7 +117,7 @@ private:
 
 CatDpsDruidStrategy::CatDpsDruidStrategy(PlayerbotAI* botAI) : FeralDruidStrategy(botAI)
 {
-    actionNodeFactories.Add(new CatDpsDruidStrategyActionNodeFactory());
+    actionNodeFactories.Add<CatDpsDruidStrategyActionNodeFactory>();
 }
 
 NextAction** CatDpsDruidStrategy::getDefaultActions()
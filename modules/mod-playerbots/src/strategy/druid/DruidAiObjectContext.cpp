@@ -321,8 +321,8 @@ private:
 
 DruidAiObjectContext::DruidAiObjectContext(PlayerbotAI* botAI) : AiObjectContext(botAI)
 {
-    strategyContexts.Add(new DruidStrategyFactoryInternal());
-    strategyContexts.Add(new DruidDruidStrategyFactoryInternal());
-    actionContexts.Add(new DruidAiObjectContextInternal());
-    triggerContexts.Add(new DruidTriggerFactoryInternal());
+    strategyContexts.Add<DruidStrategyFactoryInternal>();
+    strategyContexts.Add<DruidDruidStrategyFactoryInternal>();
+    actionContexts.Add<DruidAiObjectContextInternal>();
+    triggerContexts.Add<DruidTriggerFactoryInternal>();
 }
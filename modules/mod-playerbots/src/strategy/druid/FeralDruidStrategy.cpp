@@ -90,8 +90,8 @@ private:
 
 FeralDruidStrategy::FeralDruidStrategy(PlayerbotAI* botAI) : GenericDruidStrategy(botAI)
 {
-    actionNodeFactories.Add(new FeralDruidStrategyActionNodeFactory());
-    actionNodeFactories.Add(new ShapeshiftDruidStrategyActionNodeFactory());
+    actionNodeFactories.Add<FeralDruidStrategyActionNodeFactory>();
+    actionNodeFactories.Add<ShapeshiftDruidStrategyActionNodeFactory>();
 }
 
 void FeralDruidStrategy::InitTriggers(std::vector<TriggerNode*>& triggers)
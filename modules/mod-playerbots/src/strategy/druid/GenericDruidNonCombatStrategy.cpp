@@ -102,7 +102,7 @@ private:
 
 GenericDruidNonCombatStrategy::GenericDruidNonCombatStrategy(PlayerbotAI* botAI) : NonCombatStrategy(botAI)
 {
-    actionNodeFactories.Add(new GenericDruidNonCombatStrategyActionNodeFactory());
+    actionNodeFactories.Add<GenericDruidNonCombatStrategyActionNodeFactory>();
 }
 
 void GenericDruidNonCombatStrategy::InitTriggers(std::vector<TriggerNode*>& triggers)
@@ -157,7 +157,7 @@ void GenericDruidNonCombatStrategy::InitTriggers(std::vector<TriggerNode*>& trig
 
 GenericDruidBuffStrategy::GenericDruidBuffStrategy(PlayerbotAI* botAI) : NonCombatStrategy(botAI)
 {
-    actionNodeFactories.Add(new GenericDruidNonCombatStrategyActionNodeFactory());
+    actionNodeFactories.Add<GenericDruidNonCombatStrategyActionNodeFactory>();
 }
 
 void GenericDruidBuffStrategy::InitTriggers(std::vector<TriggerNode*>& triggers)
@@ -99,7 +99,7 @@ private:
 
 GenericDruidStrategy::GenericDruidStrategy(PlayerbotAI* botAI) : CombatStrategy(botAI)
 {
-    actionNodeFactories.Add(new GenericDruidStrategyActionNodeFactory());
+    actionNodeFactories.Add<GenericDruidStrategyActionNodeFactory>();
 }
 
 void GenericDruidStrategy::InitTriggers(std::vector<TriggerNode*>& triggers)
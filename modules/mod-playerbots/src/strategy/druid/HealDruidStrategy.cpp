@@ -50,7 +50,7 @@ private:
 
 HealDruidStrategy::HealDruidStrategy(PlayerbotAI* botAI) : GenericDruidStrategy(botAI)
 {
-    actionNodeFactories.Add(new HealDruidStrategyActionNodeFactory());
+    actionNodeFactories.Add<HealDruidStrategyActionNodeFactory>();
 }
 
 void HealDruidStrategy::InitTriggers(std::vector<TriggerNode*>& triggers)
@@ -98,7 +98,7 @@ void ChatCommandHandlerStrategy::InitTriggers(std::vector<TriggerNode*>& trigger
 
 ChatCommandHandlerStrategy::ChatCommandHandlerStrategy(PlayerbotAI* botAI) : PassTroughStrategy(botAI)
 {
-    actionNodeFactories.Add(new ChatCommandActionNodeFactoryInternal());
+    actionNodeFactories.Add<ChatCommandActionNodeFactoryInternal>();
 
     supported.push_back("quests");
     supported.push_back("stats");
@@ -42,5 +42,5 @@ void RacialsStrategy::InitTriggers(std::vector<TriggerNode*>& triggers)
 
 RacialsStrategy::RacialsStrategy(PlayerbotAI* botAI) : Strategy(botAI)
 {
-    actionNodeFactories.Add(new RacialsStrategyActionNodeFactory());
+    actionNodeFactories.Add<RacialsStrategyActionNodeFactory>();
 }
@@ -24,7 +24,7 @@ private:
 
 UsePotionsStrategy::UsePotionsStrategy(PlayerbotAI* botAI) : Strategy(botAI)
 {
-    actionNodeFactories.Add(new UsePotionsStrategyActionNodeFactory());
+    actionNodeFactories.Add<UsePotionsStrategyActionNodeFactory>();
 }
 
 void UsePotionsStrategy::InitTriggers(std::vector<TriggerNode*>& triggers)
@@ -35,7 +35,7 @@ private:
 
 DpsHunterStrategy::DpsHunterStrategy(PlayerbotAI* botAI) : GenericHunterStrategy(botAI)
 {
-    actionNodeFactories.Add(new DpsHunterStrategyActionNodeFactory());
+    actionNodeFactories.Add<DpsHunterStrategyActionNodeFactory>();
 }
 
 NextAction** DpsHunterStrategy::getDefaultActions()
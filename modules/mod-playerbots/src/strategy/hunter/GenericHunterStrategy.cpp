@@ -74,7 +74,7 @@ private:
 
 GenericHunterStrategy::GenericHunterStrategy(PlayerbotAI* botAI) : CombatStrategy(botAI)
 {
-    actionNodeFactories.Add(new GenericHunterStrategyActionNodeFactory());
+    actionNodeFactories.Add<GenericHunterStrategyActionNodeFactory>();
 }
 
 void GenericHunterStrategy::InitTriggers(std::vector<TriggerNode*>& triggers)
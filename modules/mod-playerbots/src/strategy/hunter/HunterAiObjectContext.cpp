@@ -226,8 +226,8 @@ private:
 
 HunterAiObjectContext::HunterAiObjectContext(PlayerbotAI* botAI) : AiObjectContext(botAI)
 {
-    strategyContexts.Add(new HunterStrategyFactoryInternal());
-    strategyContexts.Add(new HunterBuffStrategyFactoryInternal());
-    actionContexts.Add(new HunterAiObjectContextInternal());
-    triggerContexts.Add(new HunterTriggerFactoryInternal());
+    strategyContexts.Add<HunterStrategyFactoryInternal>();
+    strategyContexts.Add<HunterBuffStrategyFactoryInternal>();
+    actionContexts.Add<HunterAiObjectContextInternal>();
+    triggerContexts.Add<HunterTriggerFactoryInternal>();
 }
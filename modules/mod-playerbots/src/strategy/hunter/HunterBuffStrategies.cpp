@@ -24,7 +24,7 @@ private:
 
 HunterBuffDpsStrategy::HunterBuffDpsStrategy(PlayerbotAI* botAI) : NonCombatStrategy(botAI)
 {
-    actionNodeFactories.Add(new BuffHunterStrategyActionNodeFactory());
+    actionNodeFactories.Add<BuffHunterStrategyActionNodeFactory>();
 }
 
 void HunterBuffDpsStrategy::InitTriggers(std::vector<TriggerNode*>& triggers)
@@ -54,7 +54,7 @@ private:
 
 ArcaneMageStrategy::ArcaneMageStrategy(PlayerbotAI* botAI) : GenericMageStrategy(botAI)
 {
-    actionNodeFactories.Add(new ArcaneMageStrategyActionNodeFactory());
+    actionNodeFactories.Add<ArcaneMageStrategyActionNodeFactory>();
 }
 
 NextAction** ArcaneMageStrategy::getDefaultActions()
@@ -54,7 +54,7 @@ private:
 
 FrostMageStrategy::FrostMageStrategy(PlayerbotAI* botAI) : GenericMageStrategy(botAI)
 {
-    actionNodeFactories.Add(new FrostMageStrategyActionNodeFactory());
+    actionNodeFactories.Add<FrostMageStrategyActionNodeFactory>();
 }
 
 NextAction** FrostMageStrategy::getDefaultActions()
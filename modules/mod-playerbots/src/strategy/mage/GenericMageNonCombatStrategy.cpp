@@ -45,7 +45,7 @@ private:
 
 GenericMageNonCombatStrategy::GenericMageNonCombatStrategy(PlayerbotAI* botAI) : NonCombatStrategy(botAI)
 {
-    actionNodeFactories.Add(new GenericMageNonCombatStrategyActionNodeFactory());
+    actionNodeFactories.Add<GenericMageNonCombatStrategyActionNodeFactory>();
 }
 
 void GenericMageNonCombatStrategy::InitTriggers(std::vector<TriggerNode*>& triggers)
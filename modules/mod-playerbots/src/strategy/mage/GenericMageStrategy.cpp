@@ -153,7 +153,7 @@ private:
 
 GenericMageStrategy::GenericMageStrategy(PlayerbotAI* botAI) : RangedCombatStrategy(botAI)
 {
-    actionNodeFactories.Add(new GenericMageStrategyActionNodeFactory());
+    actionNodeFactories.Add<GenericMageStrategyActionNodeFactory>();
 }
 
 void GenericMageStrategy::InitTriggers(std::vector<TriggerNode*>& triggers)
@@ -255,9 +255,9 @@ private:
 
 MageAiObjectContext::MageAiObjectContext(PlayerbotAI* botAI) : AiObjectContext(botAI)
 {
-    strategyContexts.Add(new MageStrategyFactoryInternal());
-    strategyContexts.Add(new MageCombatStrategyFactoryInternal());
-    strategyContexts.Add(new MageBuffStrategyFactoryInternal());
-    actionContexts.Add(new MageAiObjectContextInternal());
-    triggerContexts.Add(new MageTriggerFactoryInternal());
+    strategyContexts.Add<MageStrategyFactoryInternal>();
+    strategyContexts.Add<MageCombatStrategyFactoryInternal>();
+    strategyContexts.Add<MageBuffStrategyFactoryInternal>();
+    actionContexts.Add<MageAiObjectContextInternal>();
+    triggerContexts.Add<MageTriggerFactoryInternal>();
 }
@@ -77,7 +77,7 @@ private:
 
 DpsPaladinStrategy::DpsPaladinStrategy(PlayerbotAI* botAI) : GenericPaladinStrategy(botAI)
 {
-    actionNodeFactories.Add(new DpsPaladinStrategyActionNodeFactory());
+    actionNodeFactories.Add<DpsPaladinStrategyActionNodeFactory>();
 }
 
 NextAction** DpsPaladinStrategy::getDefaultActions()
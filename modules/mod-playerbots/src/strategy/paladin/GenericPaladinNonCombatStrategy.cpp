@@ -10,7 +10,7 @@
 
 GenericPaladinNonCombatStrategy::GenericPaladinNonCombatStrategy(PlayerbotAI* botAI) : NonCombatStrategy(botAI)
 {
-    actionNodeFactories.Add(new GenericPaladinStrategyActionNodeFactory());
+    actionNodeFactories.Add<GenericPaladinStrategyActionNodeFactory>();
 }
 
 void GenericPaladinNonCombatStrategy::InitTriggers(std::vector<TriggerNode*>& triggers)
@@ -10,7 +10,7 @@
 
 GenericPaladinStrategy::GenericPaladinStrategy(PlayerbotAI* botAI) : CombatStrategy(botAI)
 {
-    actionNodeFactories.Add(new GenericPaladinStrategyActionNodeFactory());
+    actionNodeFactories.Add<GenericPaladinStrategyActionNodeFactory>();
 }
 
 void GenericPaladinStrategy::InitTriggers(std::vector<TriggerNode*>& triggers)
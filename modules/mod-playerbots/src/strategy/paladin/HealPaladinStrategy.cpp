@@ -22,7 +22,7 @@ private:
 
 HealPaladinStrategy::HealPaladinStrategy(PlayerbotAI* botAI) : GenericPaladinStrategy(botAI)
 {
-    actionNodeFactories.Add(new HealPaladinStrategyActionNodeFactory());
+    actionNodeFactories.Add<HealPaladinStrategyActionNodeFactory>();
 }
 
 NextAction** HealPaladinStrategy::getDefaultActions()
@@ -399,10 +399,10 @@ private:
 
 PaladinAiObjectContext::PaladinAiObjectContext(PlayerbotAI* botAI) : AiObjectContext(botAI)
 {
-    strategyContexts.Add(new PaladinStrategyFactoryInternal());
-    strategyContexts.Add(new PaladinCombatStrategyFactoryInternal());
-    strategyContexts.Add(new PaladinBuffStrategyFactoryInternal());
-    strategyContexts.Add(new PaladinResistanceStrategyFactoryInternal());
-    actionContexts.Add(new PaladinAiObjectContextInternal());
-    triggerContexts.Add(new PaladinTriggerFactoryInternal());
+    strategyContexts.Add<PaladinStrategyFactoryInternal>();
+    strategyContexts.Add<PaladinCombatStrategyFactoryInternal>();
+    strategyContexts.Add<PaladinBuffStrategyFactoryInternal>();
+    strategyContexts.Add<PaladinResistanceStrategyFactoryInternal>();
+    actionContexts.Add<PaladinAiObjectContextInternal>();
+    triggerContexts.Add<PaladinTriggerFactoryInternal>();
 }
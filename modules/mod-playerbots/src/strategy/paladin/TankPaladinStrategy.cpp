@@ -55,7 +55,7 @@ private:
 
 TankPaladinStrategy::TankPaladinStrategy(PlayerbotAI* botAI) : GenericPaladinStrategy(botAI)
 {
-    actionNodeFactories.Add(new TankPaladinStrategyActionNodeFactory());
+    actionNodeFactories.Add<TankPaladinStrategyActionNodeFactory>();
 }
 
 NextAction** TankPaladinStrategy::getDefaultActions()
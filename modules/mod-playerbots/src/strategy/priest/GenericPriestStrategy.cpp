@@ -11,7 +11,7 @@
 
 GenericPriestStrategy::GenericPriestStrategy(PlayerbotAI* botAI) : RangedCombatStrategy(botAI)
 {
-    actionNodeFactories.Add(new GenericPriestStrategyActionNodeFactory());
+    actionNodeFactories.Add<GenericPriestStrategyActionNodeFactory>();
 }
 
 void GenericPriestStrategy::InitTriggers(std::vector<TriggerNode*>& triggers)
@@ -60,7 +60,7 @@ void GenericPriestStrategy::InitTriggers(std::vector<TriggerNode*>& triggers)
 
 PriestCureStrategy::PriestCureStrategy(PlayerbotAI* botAI) : Strategy(botAI)
 {
-    actionNodeFactories.Add(new CurePriestStrategyActionNodeFactory());
+    actionNodeFactories.Add<CurePriestStrategyActionNodeFactory>();
 }
 
 void PriestCureStrategy::InitTriggers(std::vector<TriggerNode*>& triggers)
@@ -10,7 +10,7 @@
 
 HealPriestStrategy::HealPriestStrategy(PlayerbotAI* botAI) : GenericPriestStrategy(botAI)
 {
-    actionNodeFactories.Add(new GenericPriestStrategyActionNodeFactory());
+    actionNodeFactories.Add<GenericPriestStrategyActionNodeFactory>();
 }
 
 NextAction** HealPriestStrategy::getDefaultActions()
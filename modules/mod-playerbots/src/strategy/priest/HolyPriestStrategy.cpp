@@ -24,7 +24,7 @@ private:
 
 HolyPriestStrategy::HolyPriestStrategy(PlayerbotAI* botAI) : HealPriestStrategy(botAI)
 {
-    actionNodeFactories.Add(new HolyPriestStrategyActionNodeFactory());
+    actionNodeFactories.Add<HolyPriestStrategyActionNodeFactory>();
 }
 
 NextAction** HolyPriestStrategy::getDefaultActions()
@@ -52,7 +52,7 @@ void HolyPriestStrategy::InitTriggers(std::vector<TriggerNode*>& triggers)
 
 HolyHealPriestStrategy::HolyHealPriestStrategy(PlayerbotAI* botAI) : GenericPriestStrategy(botAI)
 {
-    actionNodeFactories.Add(new GenericPriestStrategyActionNodeFactory());
+    actionNodeFactories.Add<GenericPriestStrategyActionNodeFactory>();
 }
 
 NextAction** HolyHealPriestStrategy::getDefaultActions()
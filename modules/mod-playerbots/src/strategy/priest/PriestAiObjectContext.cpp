@@ -354,8 +354,8 @@ private:
 
 PriestAiObjectContext::PriestAiObjectContext(PlayerbotAI* botAI) : AiObjectContext(botAI)
 {
-    strategyContexts.Add(new PriestStrategyFactoryInternal());
-    strategyContexts.Add(new PriestCombatStrategyFactoryInternal());
-    actionContexts.Add(new PriestAiObjectContextInternal());
-    triggerContexts.Add(new PriestTriggerFactoryInternal());
+    strategyContexts.Add<PriestStrategyFactoryInternal>();
+    strategyContexts.Add<PriestCombatStrategyFactoryInternal>();
+    actionContexts.Add<PriestAiObjectContextInternal>();
+    triggerContexts.Add<PriestTriggerFactoryInternal>();
 }
@@ -10,7 +10,7 @@
 
 ShadowPriestStrategy::ShadowPriestStrategy(PlayerbotAI* botAI) : GenericPriestStrategy(botAI)
 {
-    actionNodeFactories.Add(new ShadowPriestStrategyActionNodeFactory());
+    actionNodeFactories.Add<ShadowPriestStrategyActionNodeFactory>();
 }
 
 NextAction** ShadowPriestStrategy::getDefaultActions()
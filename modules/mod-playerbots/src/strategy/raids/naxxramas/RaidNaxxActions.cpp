@@ -8,6 +8,7 @@
 #include "RaidNaxxBossHelper.h"
 #include "RaidNaxxStrategy.h"
 #include "ScriptedCreature.h"
+#include "ServerFacade.h"
 #include "SharedDefines.h"
 
 bool GrobbulusGoBehindAction::Execute(Event event)
@@ -127,7 +128,7 @@ bool ThaddiusAttackNearestPetAction::isUseful()
 bool ThaddiusAttackNearestPetAction::Execute(Event event)
 {
     Unit* target = helper.GetNearestPet();
-    if (!bot->IsWithinLOSInMap(target))
+    if (!sServerFacade->IsWithinLOSInMap(bot, target))
     {
         return MoveTo(target, 0, MovementPriority::MOVEMENT_COMBAT);
     }
@@ -449,7 +450,7 @@ bool HorsemanAttactInOrderAction::Execute(Event event)
         {
             return false;
         }
-        if (!bot->IsWithinLOSInMap(target))
+        if (!sServerFacade->IsWithinLOSInMap(bot, target))
         {
             return MoveNear(target, 22.0f, MovementPriority::MOVEMENT_COMBAT);
         }
@@ -31,7 +31,7 @@ private:
 
 AssassinationRogueStrategy::AssassinationRogueStrategy(PlayerbotAI* ai) : MeleeCombatStrategy(ai)
 {
-    actionNodeFactories.Add(new AssassinationRogueStrategyActionNodeFactory());
+    actionNodeFactories.Add<AssassinationRogueStrategyActionNodeFactory>();
 }
 
 NextAction** AssassinationRogueStrategy::getDefaultActions()
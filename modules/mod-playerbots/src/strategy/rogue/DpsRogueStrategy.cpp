@@ -75,7 +75,7 @@ private:
 
 DpsRogueStrategy::DpsRogueStrategy(PlayerbotAI* botAI) : MeleeCombatStrategy(botAI)
 {
-    actionNodeFactories.Add(new DpsRogueStrategyActionNodeFactory());
+    actionNodeFactories.Add<DpsRogueStrategyActionNodeFactory>();
 }
 
 NextAction** DpsRogueStrategy::getDefaultActions()
@@ -201,7 +201,7 @@ private:
 
 StealthedRogueStrategy::StealthedRogueStrategy(PlayerbotAI* botAI) : Strategy(botAI)
 {
-    actionNodeFactories.Add(new StealthedRogueStrategyActionNodeFactory());
+    actionNodeFactories.Add<StealthedRogueStrategyActionNodeFactory>();
 }
 
 NextAction** StealthedRogueStrategy::getDefaultActions()
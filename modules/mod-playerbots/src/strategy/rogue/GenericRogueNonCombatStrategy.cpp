@@ -27,7 +27,7 @@ private:
 
 GenericRogueNonCombatStrategy::GenericRogueNonCombatStrategy(PlayerbotAI* botAI) : NonCombatStrategy(botAI)
 {
-    actionNodeFactories.Add(new GenericRogueNonCombatStrategyActionNodeFactory());
+    actionNodeFactories.Add<GenericRogueNonCombatStrategyActionNodeFactory>();
 }
 
 void GenericRogueNonCombatStrategy::InitTriggers(std::vector<TriggerNode*>& triggers)
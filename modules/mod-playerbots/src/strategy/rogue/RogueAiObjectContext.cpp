@@ -187,8 +187,8 @@ private:
 
 RogueAiObjectContext::RogueAiObjectContext(PlayerbotAI* botAI) : AiObjectContext(botAI)
 {
-    strategyContexts.Add(new RogueStrategyFactoryInternal());
-    strategyContexts.Add(new RogueCombatStrategyFactoryInternal());
-    actionContexts.Add(new RogueAiObjectContextInternal());
-    triggerContexts.Add(new RogueTriggerFactoryInternal());
+    strategyContexts.Add<RogueStrategyFactoryInternal>();
+    strategyContexts.Add<RogueCombatStrategyFactoryInternal>();
+    actionContexts.Add<RogueAiObjectContextInternal>();
+    triggerContexts.Add<RogueTriggerFactoryInternal>();
 }
@@ -35,7 +35,7 @@ private:
 
 CasterShamanStrategy::CasterShamanStrategy(PlayerbotAI* botAI) : GenericShamanStrategy(botAI)
 {
-    actionNodeFactories.Add(new CasterShamanStrategyActionNodeFactory());
+    actionNodeFactories.Add<CasterShamanStrategyActionNodeFactory>();
 }
 
 NextAction** CasterShamanStrategy::getDefaultActions()
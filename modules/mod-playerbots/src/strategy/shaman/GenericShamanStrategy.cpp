@@ -101,7 +101,7 @@ private:
 
 GenericShamanStrategy::GenericShamanStrategy(PlayerbotAI* botAI) : CombatStrategy(botAI)
 {
-    actionNodeFactories.Add(new GenericShamanStrategyActionNodeFactory());
+    actionNodeFactories.Add<GenericShamanStrategyActionNodeFactory>();
 }
 
 void GenericShamanStrategy::InitTriggers(std::vector<TriggerNode*>& triggers)
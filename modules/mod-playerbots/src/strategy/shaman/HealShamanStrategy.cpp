@@ -36,7 +36,7 @@ private:
 
 HealShamanStrategy::HealShamanStrategy(PlayerbotAI* botAI) : GenericShamanStrategy(botAI)
 {
-    actionNodeFactories.Add(new HealShamanStrategyActionNodeFactory());
+    actionNodeFactories.Add<HealShamanStrategyActionNodeFactory>();
 }
 
 void HealShamanStrategy::InitTriggers(std::vector<TriggerNode*>& triggers)
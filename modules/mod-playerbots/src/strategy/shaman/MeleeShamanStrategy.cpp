@@ -46,7 +46,7 @@ private:
 
 MeleeShamanStrategy::MeleeShamanStrategy(PlayerbotAI* botAI) : GenericShamanStrategy(botAI)
 {
-    actionNodeFactories.Add(new MeleeShamanStrategyActionNodeFactory());
+    actionNodeFactories.Add<MeleeShamanStrategyActionNodeFactory>();
 }
 
 NextAction** MeleeShamanStrategy::getDefaultActions()
@@ -330,9 +330,9 @@ private:
 
 ShamanAiObjectContext::ShamanAiObjectContext(PlayerbotAI* botAI) : AiObjectContext(botAI)
 {
-    strategyContexts.Add(new ShamanStrategyFactoryInternal());
-    strategyContexts.Add(new ShamanCombatStrategyFactoryInternal());
-    strategyContexts.Add(new ShamanBuffStrategyFactoryInternal());
-    actionContexts.Add(new ShamanAiObjectContextInternal());
-    triggerContexts.Add(new ShamanATriggerFactoryInternal());
+    strategyContexts.Add<ShamanStrategyFactoryInternal>();
+    strategyContexts.Add<ShamanCombatStrategyFactoryInternal>();
+    strategyContexts.Add<ShamanBuffStrategyFactoryInternal>();
+    actionContexts.Add<ShamanAiObjectContextInternal>();
+    triggerContexts.Add<ShamanATriggerFactoryInternal>();
 }
@@ -20,6 +20,7 @@ public:
     void ExternalEvent(std::string const param, Player* owner = nullptr) override;
     Event Check() override;
     void Reset() override;
+    bool IsEventDriven() override { return true; }
 
 private:
     std::string param;
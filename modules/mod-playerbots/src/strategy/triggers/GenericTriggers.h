@@ -33,6 +33,7 @@ public:
     HighManaTrigger(PlayerbotAI* botAI) : Trigger(botAI, "high mana") {}
 
     bool IsActive() override;
+    bool IsParallelSafe() override { return true; }
 };
 
 class EnoughManaTrigger : public Trigger
@@ -41,6 +42,7 @@ public:
     EnoughManaTrigger(PlayerbotAI* botAI) : Trigger(botAI, "enough mana") {}
 
     bool IsActive() override;
+    bool IsParallelSafe() override { return true; }
 };
 
 class AlmostFullManaTrigger : public Trigger
@@ -49,6 +51,7 @@ public:
     AlmostFullManaTrigger(PlayerbotAI* botAI) : Trigger(botAI, "almost full mana") {}
 
     bool IsActive() override;
+    bool IsParallelSafe() override { return true; }
 };
 
 class RageAvailable : public StatAvailable
@@ -57,6 +60,7 @@ public:
     RageAvailable(PlayerbotAI* botAI, int32 amount) : StatAvailable(botAI, amount, "rage available") {}
 
     bool IsActive() override;
+    bool IsParallelSafe() override { return true; }
 };
 
 class LightRageAvailableTrigger : public RageAvailable
@@ -83,6 +87,7 @@ public:
     EnergyAvailable(PlayerbotAI* botAI, int32 amount) : StatAvailable(botAI, amount, "energy available") {}
 
     bool IsActive() override;
+    bool IsParallelSafe() override { return true; }
 };
 
 class LightEnergyAvailableTrigger : public EnergyAvailable
@@ -531,6 +536,7 @@ public:
     LowManaTrigger(PlayerbotAI* botAI) : Trigger(botAI, "low mana") {}
 
     bool IsActive() override;
+    bool IsParallelSafe() override { return true; }
 };
 
 class MediumManaTrigger : public Trigger
@@ -539,6 +545,7 @@ public:
     MediumManaTrigger(PlayerbotAI* botAI) : Trigger(botAI, "medium mana") {}
 
     bool IsActive() override;
+    bool IsParallelSafe() override { return true; }
 };
 
 BEGIN_TRIGGER(PanicTrigger, Trigger)
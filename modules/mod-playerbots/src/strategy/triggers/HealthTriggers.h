@@ -42,6 +42,7 @@ public:
 
     bool IsActive() override;
     float GetValue() override;
+    bool IsParallelSafe() override { return true; }
 };
 
 class LowHealthTrigger : public HealthInRangeTrigger
@@ -167,6 +168,7 @@ public:
 
     std::string const GetTargetName() override { return "self target"; }
     bool IsActive() override;
+    bool IsParallelSafe() override { return true; }
 };
 
 class AoeHealTrigger : public Trigger
@@ -177,6 +179,7 @@ public:
     {
     }  // reorder args - whipowill
     bool IsActive() override;
+    bool IsParallelSafe() override { return true; }
 
 protected:
     int32 count;
@@ -191,6 +194,7 @@ public:
     {
     }
     bool IsActive() override;
+    bool IsParallelSafe() override { return true; }
 
 protected:
     std::string type;
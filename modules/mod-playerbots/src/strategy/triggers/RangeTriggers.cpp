@@ -190,7 +190,7 @@ bool PartyMemberToHealOutOfSpellRangeTrigger::IsActive()
 
     float combatReach = bot->GetCombatReach() + target->GetCombatReach();
     return target && (sServerFacade->GetDistance2d(bot, target) > (distance + sPlayerbotAIConfig->contactDistance) ||
-                      !bot->IsWithinLOSInMap(target));
+                      !sServerFacade->IsWithinLOSInMap(bot, target));
 }
 
 PartyMemberToHealOutOfSpellRangeTrigger::PartyMemberToHealOutOfSpellRangeTrigger(PlayerbotAI* botAI)
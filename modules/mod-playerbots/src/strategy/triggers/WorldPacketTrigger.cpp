@@ -7,7 +7,7 @@
 
 #include "Playerbots.h"
 
-void WorldPacketTrigger::ExternalEvent(WorldPacket& revData, Player* eventOwner)
+void WorldPacketTrigger::ExternalEvent(std::shared_ptr<WorldPacket const> const& revData, Player* eventOwner)
 {
     packet = revData;
     owner = eventOwner;
@@ -22,4 +22,8 @@ Event WorldPacketTrigger::Check()
     return Event(getName(), packet, owner);
 }
 
-void WorldPacketTrigger::Reset() { triggered = false; }
+void WorldPacketTrigger::Reset()
+{
+    triggered = false;
+    packet.reset();
+}
@@ -18,12 +18,14 @@ class WorldPacketTrigger : public Trigger
 public:
     WorldPacketTrigger(PlayerbotAI* botAI, std::string const command) : Trigger(botAI, command), triggered(false) {}
 
-    void ExternalEvent(WorldPacket& packet, Player* owner = nullptr) override;
+    void ExternalEvent(std::shared_ptr<WorldPacket const> const& packet, Player* owner = nullptr) override;
     Event Check() override;
     void Reset() override;
+    bool IsEventDriven() override { return true; }
 
 private:
-    WorldPacket packet;
+    // shared with the other bots the packet reached
+    std::shared_ptr<WorldPacket const> packet;
     bool triggered;
     Player* owner;
 };
@@ -117,7 +117,7 @@ Unit* GrindTargetValue::FindTargetForGrinding(uint32 assistCount)
                 if (CreatureTemplate->rank > CREATURE_ELITE_NORMAL && !AI_VALUE(bool, "can fight elite"))
                     continue;
 
-        if (!bot->IsWithinLOSInMap(unit))
+        if (!sServerFacade->IsWithinLOSInMap(bot, unit))
         {
             continue;
         }
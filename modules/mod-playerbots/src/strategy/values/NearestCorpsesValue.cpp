@@ -5,9 +5,7 @@
 
 #include "NearestCorpsesValue.h"
 
-#include "CellImpl.h"
 #include "GridNotifiers.h"
-#include "GridNotifiersImpl.h"
 #include "Playerbots.h"
 
 class AnyDeadUnitInObjectRangeCheck
@@ -25,8 +23,7 @@ private:
 void NearestCorpsesValue::FindUnits(std::list<Unit*>& targets)
 {
     AnyDeadUnitInObjectRangeCheck u_check(bot, range);
-    Acore::UnitListSearcher<AnyDeadUnitInObjectRangeCheck> searcher(bot, targets, u_check);
-    Cell::VisitAllObjects(bot, searcher, range);
+    SearchUnits(u_check, targets);
 }
 
 bool NearestCorpsesValue::AcceptUnit(Unit* unit) { return true; }
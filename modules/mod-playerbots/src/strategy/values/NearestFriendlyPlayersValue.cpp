@@ -5,16 +5,13 @@
 
 #include "NearestFriendlyPlayersValue.h"
 
-#include "CellImpl.h"
 #include "GridNotifiers.h"
-#include "GridNotifiersImpl.h"
 #include "Playerbots.h"
 
 void NearestFriendlyPlayersValue::FindUnits(std::list<Unit*>& targets)
 {
     Acore::AnyFriendlyUnitInObjectRangeCheck u_check(bot, bot, range);
-    Acore::UnitListSearcher<Acore::AnyFriendlyUnitInObjectRangeCheck> searcher(bot, targets, u_check);
-    Cell::VisitAllObjects(bot, searcher, range);
+    SearchUnits(u_check, targets);
 }
 
 bool NearestFriendlyPlayersValue::AcceptUnit(Unit* unit)
@@ -5,16 +5,13 @@
 
 #include "NearestNonBotPlayersValue.h"
 
-#include "CellImpl.h"
 #include "GridNotifiers.h"
-#include "GridNotifiersImpl.h"
 #include "Playerbots.h"
 
 void NearestNonBotPlayersValue::FindUnits(std::list<Unit*>& targets)
 {
     Acore::AnyUnitInObjectRangeCheck u_check(bot, range);
-    Acore::UnitListSearcher<Acore::AnyUnitInObjectRangeCheck> searcher(bot, targets, u_check);
-    Cell::VisitAllObjects(bot, searcher, range);
+    SearchUnits(u_check, targets);
 }
 
 bool NearestNonBotPlayersValue::AcceptUnit(Unit* unit)
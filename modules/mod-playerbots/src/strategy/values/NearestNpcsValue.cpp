@@ -5,17 +5,14 @@
 
 #include "NearestNpcsValue.h"
 
-#include "CellImpl.h"
 #include "GridNotifiers.h"
-#include "GridNotifiersImpl.h"
 #include "Playerbots.h"
 #include "Vehicle.h"
 
 void NearestNpcsValue::FindUnits(std::list<Unit*>& targets)
 {
     Acore::AnyUnitInObjectRangeCheck u_check(bot, range);
-    Acore::UnitListSearcher<Acore::AnyUnitInObjectRangeCheck> searcher(bot, targets, u_check);
-    Cell::VisitAllObjects(bot, searcher, range);
+    SearchUnits(u_check, targets);
 }
 
 bool NearestNpcsValue::AcceptUnit(Unit* unit) { return !unit->IsHostileTo(bot) && !unit->IsPlayer(); }
@@ -23,8 +20,7 @@ bool NearestNpcsValue::AcceptUnit(Unit* unit) { return !unit->IsHostileTo(bot) &
 void NearestHostileNpcsValue::FindUnits(std::list<Unit*>& targets)
 {
     Acore::AnyUnitInObjectRangeCheck u_check(bot, range);
-    Acore::UnitListSearcher<Acore::AnyUnitInObjectRangeCheck> searcher(bot, targets, u_check);
-    Cell::VisitAllObjects(bot, searcher, range);
+    SearchUnits(u_check, targets);
 }
 
 bool NearestHostileNpcsValue::AcceptUnit(Unit* unit) { return unit->IsHostileTo(bot) && !unit->IsPlayer(); }
@@ -32,8 +28,7 @@ bool NearestHostileNpcsValue::AcceptUnit(Unit* unit) { return unit->IsHostileTo(
 void NearestVehiclesValue::FindUnits(std::list<Unit*>& targets)
 {
     Acore::AnyUnitInObjectRangeCheck u_check(bot, range);
-    Acore::UnitListSearcher<Acore::AnyUnitInObjectRangeCheck> searcher(bot, targets, u_check);
-    Cell::VisitAllObjects(bot, searcher, range);
+    SearchUnits(u_check, targets);
 }
 
 bool NearestVehiclesValue::AcceptUnit(Unit* unit)
@@ -51,8 +46,7 @@ bool NearestVehiclesValue::AcceptUnit(Unit* unit)
 void NearestTriggersValue::FindUnits(std::list<Unit*>& targets)
 {
     Acore::AnyUnfriendlyUnitInObjectRangeCheck u_check(bot, bot, range);
-    Acore::UnitListSearcher<Acore::AnyUnfriendlyUnitInObjectRangeCheck> searcher(bot, targets, u_check);
-    Cell::VisitAllObjects(bot, searcher, range);
+    SearchUnits(u_check, targets);
 }
 
 bool NearestTriggersValue::AcceptUnit(Unit* unit) { return !unit->IsPlayer(); }
@@ -60,8 +54,7 @@ bool NearestTriggersValue::AcceptUnit(Unit* unit) { return !unit->IsPlayer(); }
 void NearestTotemsValue::FindUnits(std::list<Unit*>& targets)
 {
     Acore::AnyUnitInObjectRangeCheck u_check(bot, range);
-    Acore::UnitListSearcher<Acore::AnyUnitInObjectRangeCheck> searcher(bot, targets, u_check);
-    Cell::VisitAllObjects(bot, searcher, range);
+    SearchUnits(u_check, targets);
 }
 
 bool NearestTotemsValue::AcceptUnit(Unit* unit) { return unit->IsTotem(); }
\ No newline at end of file
@@ -6,6 +6,8 @@
 #include "NearestUnitsValue.h"
 
 #include "Playerbots.h"
+#include "ServerFacade.h"
+#include "UnitSnapshotMgr.h"
 
 GuidVector NearestUnitsValue::Calculate()
 {
@@ -15,9 +17,11 @@ GuidVector NearestUnitsValue::Calculate()
     GuidVector results;
     for (Unit* unit : targets)
     {
-        if (AcceptUnit(unit) && (ignoreLos || bot->IsWithinLOSInMap(unit)))
+        if (AcceptUnit(unit) && (ignoreLos || sServerFacade->IsWithinLOSInMap(bot, unit)))
             results.push_back(unit->GetGUID());
     }
 
     return results;
 }
+
+void NearestUnitsValue::GetSnapshotUnits(std::vector<Unit*>& units) { sUnitSnapshotMgr->GetUnits(bot, range, units); }
@@ -27,6 +27,22 @@ protected:
     virtual void FindUnits(std::list<Unit*>& targets) = 0;
     virtual bool AcceptUnit(Unit* unit) = 0;
 
+    // Same as a UnitListSearcher over Cell::VisitAllObjects, the cells are shared with the other bots of the map.
+    template <class Check>
+    void SearchUnits(Check& check, std::list<Unit*>& targets)
+    {
+        std::vector<Unit*> units;
+        GetSnapshotUnits(units);
+
+        for (Unit* unit : units)
+        {
+            if (check(unit))
+                targets.push_back(unit);
+        }
+    }
+
+    void GetSnapshotUnits(std::vector<Unit*>& units);
+
     float range;
     bool ignoreLos;
 };
@@ -8,6 +8,7 @@
 #include "Arrow.h"
 #include "Event.h"
 #include "Playerbots.h"
+#include "ServerFacade.h"
 
 Unit* Stance::GetTarget()
 {
@@ -39,7 +40,7 @@ WorldLocation Stance::GetNearLocation(float angle, float distance)
     float y = target->GetPositionY() + sin(angle) * distance;
     float z = target->GetPositionZ();
 
-    if (bot->IsWithinLOS(x, y, z))
+    if (sServerFacade->IsWithinLOS(bot, x, y, z))
         return WorldLocation(bot->GetMapId(), x, y, z);
 
     return Formation::NullLocation;
@@ -43,7 +43,7 @@ private:
 
 DpsWarlockStrategy::DpsWarlockStrategy(PlayerbotAI* botAI) : GenericWarlockStrategy(botAI)
 {
-    actionNodeFactories.Add(new DpsWarlockStrategyActionNodeFactory());
+    actionNodeFactories.Add<DpsWarlockStrategyActionNodeFactory>();
 }
 
 NextAction** DpsWarlockStrategy::getDefaultActions()
@@ -69,7 +69,7 @@ private:
 
 GenericWarlockNonCombatStrategy::GenericWarlockNonCombatStrategy(PlayerbotAI* botAI) : NonCombatStrategy(botAI)
 {
-    actionNodeFactories.Add(new GenericWarlockNonCombatStrategyActionNodeFactory());
+    actionNodeFactories.Add<GenericWarlockNonCombatStrategyActionNodeFactory>();
 }
 
 void GenericWarlockNonCombatStrategy::InitTriggers(std::vector<TriggerNode*>& triggers)
@@ -35,7 +35,7 @@ private:
 
 GenericWarlockStrategy::GenericWarlockStrategy(PlayerbotAI* botAI) : RangedCombatStrategy(botAI)
 {
-    actionNodeFactories.Add(new GenericWarlockStrategyActionNodeFactory());
+    actionNodeFactories.Add<GenericWarlockStrategyActionNodeFactory>();
 }
 
 NextAction** GenericWarlockStrategy::getDefaultActions() { return NextAction::array(0, nullptr); }
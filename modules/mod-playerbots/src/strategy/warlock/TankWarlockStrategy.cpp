@@ -54,7 +54,7 @@ private:
 
 TankWarlockStrategy::TankWarlockStrategy(PlayerbotAI* botAI) : GenericWarlockStrategy(botAI)
 {
-    actionNodeFactories.Add(new GenericWarlockStrategyActionNodeFactory());
+    actionNodeFactories.Add<GenericWarlockStrategyActionNodeFactory>();
 }
 
 NextAction** TankWarlockStrategy::getDefaultActions()
@@ -243,9 +243,9 @@ private:
 
 WarlockAiObjectContext::WarlockAiObjectContext(PlayerbotAI* botAI) : AiObjectContext(botAI)
 {
-    strategyContexts.Add(new WarlockStrategyFactoryInternal());
-    strategyContexts.Add(new WarlockCombatStrategyFactoryInternal());
-    strategyContexts.Add(new NonCombatBuffStrategyFactoryInternal());
-    actionContexts.Add(new WarlockAiObjectContextInternal());
-    triggerContexts.Add(new WarlockTriggerFactoryInternal());
+    strategyContexts.Add<WarlockStrategyFactoryInternal>();
+    strategyContexts.Add<WarlockCombatStrategyFactoryInternal>();
+    strategyContexts.Add<NonCombatBuffStrategyFactoryInternal>();
+    actionContexts.Add<WarlockAiObjectContextInternal>();
+    triggerContexts.Add<WarlockTriggerFactoryInternal>();
 }
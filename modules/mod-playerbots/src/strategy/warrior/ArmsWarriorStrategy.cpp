@@ -29,7 +29,7 @@ private:
 
 ArmsWarriorStrategy::ArmsWarriorStrategy(PlayerbotAI* botAI) : GenericWarriorStrategy(botAI)
 {
-    actionNodeFactories.Add(new ArmsWarriorStrategyActionNodeFactory());
+    actionNodeFactories.Add<ArmsWarriorStrategyActionNodeFactory>();
 }
 
 NextAction** ArmsWarriorStrategy::getDefaultActions()
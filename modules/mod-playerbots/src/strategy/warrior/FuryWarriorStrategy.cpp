@@ -31,7 +31,7 @@ private:
 
 FuryWarriorStrategy::FuryWarriorStrategy(PlayerbotAI* botAI) : GenericWarriorStrategy(botAI)
 {
-    actionNodeFactories.Add(new FuryWarriorStrategyActionNodeFactory());
+    actionNodeFactories.Add<FuryWarriorStrategyActionNodeFactory>();
 }
 
 NextAction** FuryWarriorStrategy::getDefaultActions()
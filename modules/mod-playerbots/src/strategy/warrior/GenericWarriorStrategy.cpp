@@ -9,7 +9,7 @@
 
 GenericWarriorStrategy::GenericWarriorStrategy(PlayerbotAI* botAI) : CombatStrategy(botAI)
 {
-    // actionNodeFactories.Add(new WarriorStanceRequirementActionNodeFactory());
+    // actionNodeFactories.Add<WarriorStanceRequirementActionNodeFactory>();
 }
 
 void GenericWarriorStrategy::InitTriggers(std::vector<TriggerNode*>& triggers)
@@ -39,7 +39,7 @@ private:
 
 WarrirorAoeStrategy::WarrirorAoeStrategy(PlayerbotAI* botAI) : CombatStrategy(botAI)
 {
-    actionNodeFactories.Add(new WarrirorAoeStrategyActionNodeFactory());
+    actionNodeFactories.Add<WarrirorAoeStrategyActionNodeFactory>();
 }
 
 void WarrirorAoeStrategy::InitTriggers(std::vector<TriggerNode*>& triggers)
@@ -45,7 +45,7 @@ private:
 
 TankWarriorStrategy::TankWarriorStrategy(PlayerbotAI* botAI) : GenericWarriorStrategy(botAI)
 {
-    actionNodeFactories.Add(new TankWarriorStrategyActionNodeFactory());
+    actionNodeFactories.Add<TankWarriorStrategyActionNodeFactory>();
 }
 
 NextAction** TankWarriorStrategy::getDefaultActions()
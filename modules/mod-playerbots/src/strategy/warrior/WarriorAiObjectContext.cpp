@@ -308,8 +308,8 @@ private:
 
 WarriorAiObjectContext::WarriorAiObjectContext(PlayerbotAI* botAI) : AiObjectContext(botAI)
 {
-    strategyContexts.Add(new WarriorStrategyFactoryInternal());
-    strategyContexts.Add(new WarriorCombatStrategyFactoryInternal());
-    actionContexts.Add(new WarriorAiObjectContextInternal());
-    triggerContexts.Add(new WarriorTriggerFactoryInternal());
+    strategyContexts.Add<WarriorStrategyFactoryInternal>();
+    strategyContexts.Add<WarriorCombatStrategyFactoryInternal>();
+    actionContexts.Add<WarriorAiObjectContextInternal>();
+    triggerContexts.Add<WarriorTriggerFactoryInternal>();
 }
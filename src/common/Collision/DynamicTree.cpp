@@ -30,12 +30,23 @@
 #include <G3D/AABox.h>
 #include <G3D/Ray.h>
 #include <G3D/Vector3.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
 
 using VMAP::ModelInstance;
 
 namespace
 {
     int CHECK_TREE_PERIOD = 200;
+
+    // models changing invalidate the query results of the squares of this size they cover
+    float const VERSION_CELL_SIZE = 32.0f;
+    // squares share versions by hash, a collision only invalidates a few more results
+    uint32 const VERSION_BUCKETS = 4096;
+    // a model or line spanning more squares than this changes or checks the version of the whole map
+    float const VERSION_MAX_CELLS = 64.0f;
 }
 
 template<> struct HashTrait< GameObjectModel>
@@ -63,20 +74,70 @@ struct DynTreeImpl : public ParentTree
 
     DynTreeImpl() :
         rebalance_timer(CHECK_TREE_PERIOD),
-        unbalanced_times(0)
+        unbalanced_times(0),
+        version(0),
+        mapVersion(0)
     {
+        for (std::atomic<uint32>& cellVersion : cellVersions)
+            cellVersion = 0;
     }
 
     void insert(const Model& mdl)
     {
         base::insert(mdl);
         ++unbalanced_times;
+        invalidate(mdl.GetBounds());
     }
 
     void remove(const Model& mdl)
     {
         base::remove(mdl);
         ++unbalanced_times;
+        invalidate(mdl.GetBounds());
+    }
+
+    static uint32 getBucket(int x, int y)
+    {
+        return (uint32(x) * 73856093u ^ uint32(y) * 19349663u) % VERSION_BUCKETS;
+    }
+
+    void invalidate(G3D::AABox const& bounds)
+    {
+        uint32 stamp = ++version;
+        float lowX = std::floor(bounds.low().x / VERSION_CELL_SIZE);
+        float lowY = std::floor(bounds.low().y / VERSION_CELL_SIZE);
+        float highX = std::floor(bounds.high().x / VERSION_CELL_SIZE);
+        float highY = std::floor(bounds.high().y / VERSION_CELL_SIZE);
+
+        // also catches the infinite bounds of models without a shape
+        if (!((highX - lowX + 1.0f) * (highY - lowY + 1.0f) <= VERSION_MAX_CELLS))
+        {
+            mapVersion = stamp;
+            return;
+        }
+
+        for (int x = int(lowX); x <= int(highX); ++x)
+            for (int y = int(lowY); y <= int(highY); ++y)
+                cellVersions[getBucket(x, y)] = stamp;
+    }
+
+    uint32 getVersion(float x1, float y1, float x2, float y2) const
+    {
+        float lowX = std::floor(std::min(x1, x2) / VERSION_CELL_SIZE);
+        float lowY = std::floor(std::min(y1, y2) / VERSION_CELL_SIZE);
+        float highX = std::floor(std::max(x1, x2) / VERSION_CELL_SIZE);
+        float highY = std::floor(std::max(y1, y2) / VERSION_CELL_SIZE);
+
+        if (!((highX - lowX + 1.0f) * (highY - lowY + 1.0f) <= VERSION_MAX_CELLS))
+            return version;
+
+        // stamps only grow, so the newest one of the covered squares changes whenever any of them does
+        uint32 result = mapVersion;
+        for (int x = int(lowX); x <= int(highX); ++x)
+            for (int y = int(lowY); y <= int(highY); ++y)
+                result = std::max<uint32>(result, cellVersions[getBucket(x, y)]);
+
+        return result;
     }
 
     void balance()
@@ -105,6 +166,9 @@ struct DynTreeImpl : public ParentTree
 
     TimeTrackerSmall rebalance_timer;
     int unbalanced_times;
+    std::atomic<uint32> version;
+    std::atomic<uint32> mapVersion;
+    std::array<std::atomic<uint32>, VERSION_BUCKETS> cellVersions;
 };
 
 DynamicMapTree::DynamicMapTree() : impl(new DynTreeImpl()) { }
@@ -129,6 +193,16 @@ bool DynamicMapTree::contains(const GameObjectModel& mdl) const
     return impl->contains(mdl);
 }
 
+void DynamicMapTree::invalidate(const GameObjectModel& mdl)
+{
+    impl->invalidate(mdl.GetBounds());
+}
+
+uint32 DynamicMapTree::getVersion(float x1, float y1, float x2, float y2) const
+{
+    return impl->getVersion(x1, y1, x2, y2);
+}
+
 void DynamicMapTree::balance()
 {
     impl->balance();
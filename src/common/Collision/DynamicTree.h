@@ -61,6 +61,11 @@ public:
     [[nodiscard]] bool contains(const GameObjectModel&) const;
     [[nodiscard]] int size() const;
 
+    // version of the area around a line, changes whenever a model near it is added, removed or toggled and
+    // results of earlier queries along the line may be outdated then
+    void invalidate(const GameObjectModel&);
+    [[nodiscard]] uint32 getVersion(float x1, float y1, float x2, float y2) const;
+
     void balance();
     void update(uint32 diff);
 };
@@ -59,6 +59,7 @@ enum PlayerbotsDatabaseStatements : uint32
     PLAYERBOTS_SEL_RANDOM_BOTS_BY_OWNER_AND_EVENT,
     PLAYERBOTS_SEL_RANDOM_BOTS_BY_OWNER_AND_BOT,
     PLAYERBOTS_SEL_RANDOM_BOTS_BY_EVENT_AND_VALUE,
+    PLAYERBOTS_SEL_RANDOM_BOTS_BY_OWNER,
     PLAYERBOTS_INS_RANDOM_BOTS,
     PLAYERBOTS_DEL_RANDOM_BOTS,
     PLAYERBOTS_DEL_RANDOM_BOTS_BY_OWNER,
@@ -2614,6 +2614,9 @@ void GameObject::EnableCollision(bool enable)
         phaseMask = GetPhaseMask();
 
     m_model->enable(phaseMask);
+
+    if (Map* map = FindMap())
+        map->InvalidateGameObjectModel(*m_model);
 }
 
 void GameObject::UpdateModel()
@@ -245,6 +245,9 @@ void Object::BuildCreateUpdateBlockForPlayer(UpdateData* data, Player* target)
 
 void Object::SendUpdateToPlayer(Player* player)
 {
+    if (!player->GetSession()->WantsPacket(SMSG_UPDATE_OBJECT))
+        return;
+
     // send create update to player
     UpdateData upd;
     WorldPacket packet;
@@ -1648,7 +1648,8 @@ void Player::UpdateVisibilityOf(T* target, UpdateData& data,
     {
         if (CanSeeOrDetect(target, false, true))
         {
-            target->BuildCreateUpdateBlockForPlayer(&data, this);
+            if (GetSession()->WantsPacket(SMSG_UPDATE_OBJECT))
+                target->BuildCreateUpdateBlockForPlayer(&data, this);
             UpdateVisibilityOf_helper(m_clientGUIDs, target, visibleNow);
         }
     }
@@ -118,6 +118,10 @@ namespace Acore
 
         void SendPacket(Player* player)
         {
+            // bots without a client skip everything their AI would not read
+            if (!player->GetSession()->WantsPacket(i_message->GetOpcode()))
+                return;
+
             // never send packet to self
             if (player == i_source || (teamId != TEAM_NEUTRAL && player->GetTeamId() != teamId) || skipped_receiver == player)
                 return;
@@ -146,6 +150,9 @@ namespace Acore
 
         void SendPacket(Player* player)
         {
+            if (!player->GetSession()->WantsPacket(i_message->GetOpcode()))
+                return;
+
             // never send packet to self
             if (player == i_source || !player->HaveAtClient(i_source) || player->IsFriendlyTo(i_source))
                 return;
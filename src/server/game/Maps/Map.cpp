@@ -766,6 +766,8 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
             player->Update(s_diff);
         }
 
+        sScriptMgr->OnPlayerbotUpdateMap(this);
+
         HandleDelayedVisibility();
         return;
     }
@@ -849,6 +851,8 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
         }
     }
 
+    sScriptMgr->OnPlayerbotUpdateMap(this);
+
     for (_transportsUpdateIter = _transports.begin(); _transportsUpdateIter != _transports.end();) // pussywizard: transports updated after VisitNearbyCellsOf, grids around are loaded, everything ok
     {
         MotionTransport* transport = *_transportsUpdateIter;
@@ -88,6 +88,14 @@ void ScriptMgr::OnPlayerbotUpdateSessions(Player* player)
     });
 }
 
+void ScriptMgr::OnPlayerbotUpdateMap(Map* map)
+{
+    ExecuteScript<PlayerbotScript>([&](PlayerbotScript* script)
+    {
+        script->OnPlayerbotUpdateMap(map);
+    });
+}
+
 void ScriptMgr::OnPlayerbotLogout(Player* player)
 {
     ExecuteScript<PlayerbotScript>([&](PlayerbotScript* script)
@@ -134,6 +134,7 @@ public:
     virtual void OnPlayerbotPacketSent(Player* /*player*/, WorldPacket const* /*packet*/) { }
     virtual void OnPlayerbotUpdate(uint32 /*diff*/) { }
     virtual void OnPlayerbotUpdateSessions(Player* /*player*/) { }
+    virtual void OnPlayerbotUpdateMap(Map* /*map*/) { }
     virtual void OnPlayerbotLogout(Player* /*player*/) { }
     virtual void OnPlayerbotLogoutBots() { }
 };
@@ -746,6 +747,7 @@ public: /* PlayerbotScript */
     void OnPlayerbotPacketSent(Player* player, WorldPacket const* packet);
     void OnPlayerbotUpdate(uint32 diff);
     void OnPlayerbotUpdateSessions(Player* player);
+    void OnPlayerbotUpdateMap(Map* map);
     void OnPlayerbotLogout(Player* player);
     void OnPlayerbotLogoutBots();
 
@@ -137,7 +137,8 @@ WorldSession::WorldSession(uint32 id, std::string&& name, std::shared_ptr<WorldS
     _timeSyncClockDeltaQueue(6),
     _timeSyncClockDelta(0),
     _pendingTimeSyncRequests(),
-    _isBot(isBot)
+    _isBot(isBot),
+    _headless(false)
 {
     memset(m_Tutorials, 0, sizeof(m_Tutorials));
 
@@ -224,6 +225,7 @@ void WorldSession::SendPacket(WorldPacket const* packet)
         return;
     }
 
+    // scripts see every packet, headless bot sessions only skip building the ones nothing reads
     sScriptMgr->OnPlayerbotPacketSent(GetPlayer(), packet);
 
     if (!m_Socket)
@@ -29,10 +29,12 @@
 #include "Common.h"
 #include "DatabaseEnv.h"
 #include "GossipDef.h"
+#include "Opcodes.h"
 #include "QueryHolder.h"
 #include "Packet.h"
 #include "SharedDefines.h"
 #include "World.h"
+#include <bitset>
 #include <map>
 #include <memory>
 #include <utility>
@@ -1111,6 +1113,21 @@ public:                                                 // opcodes handlers
         return _isBot;
     }
 
+    // Bot sessions without a client only build the opcodes in this set. It has to hold every opcode
+    // an OnPlayerbotPacketSent script reads, packets that are built anyway still reach the scripts.
+    void SetHeadlessOpcodes(std::bitset<NUM_MSG_TYPES> const& opcodes)
+    {
+        _headlessOpcodes = opcodes;
+        _headless = true;
+    }
+
+    [[nodiscard]] bool IsHeadless() const { return _headless && !m_Socket; }
+
+    [[nodiscard]] bool WantsPacket(uint16 opcode) const
+    {
+        return !IsHeadless() || (opcode < NUM_MSG_TYPES && _headlessOpcodes.test(opcode));
+    }
+
 private:
     void ProcessQueryCallbacks();
 
@@ -1222,6 +1239,8 @@ private:
     uint32 _timeSyncTimer;
 
     bool _isBot;
+    bool _headless;
+    std::bitset<NUM_MSG_TYPES> _headlessOpcodes;
 
     WorldSession(WorldSession const& right) = delete;
     WorldSession& operator=(WorldSession const& right) = delete;